@@ -0,0 +1,136 @@
+/**
+ * @file adaptive_fallback_bench.cpp
+ * @brief Compares FallbackNode with AdaptiveFallbackNode on fallbacks whose children are
+ *        not written in the cheapest order. Prints the child ticks and the time needed per decision.
+ *
+ *        Usage: adaptive_fallback_bench [decisions] [work]
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/AdaptiveFallbackNode.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+/** @brief Leaf that burns `work` iterations and succeeds with the given probability. */
+class WorkLeafNode : public NodeInterface {
+   public:
+    WorkLeafNode(const std::string& name, uint64_t seed, double success_probability, uint32_t work,
+                 uint64_t& tick_counter)
+        : NodeInterface(name),
+          state_{seed},
+          threshold_{static_cast<uint32_t>(success_probability * 4294967295.0)},
+          work_{work},
+          tick_counter_{tick_counter} {}
+
+    NodeResult tick() override {
+        ++tick_counter_;
+        volatile uint64_t sink = 0;
+        for (uint32_t i = 0; i < work_; ++i) {
+            sink = sink + i;
+        }
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        const uint32_t value = static_cast<uint32_t>((state_ * 0x2545F4914F6CDD1Dull) >> 32);
+        return (value < threshold_) ? NodeResult::SUCCESS : NodeResult::FAILURE;
+    }
+
+   private:
+    uint64_t state_;
+    uint32_t threshold_;
+    uint32_t work_;
+    uint64_t& tick_counter_;
+};
+
+/** @brief Success probability and work of a child. */
+struct ChildProfile {
+    double success_probability;
+    uint32_t work;
+};
+
+/** @brief Children of a scenario, in the order written by the author of the tree. */
+struct Scenario {
+    const char* name;
+    std::vector<ChildProfile> children;
+};
+
+std::vector<std::shared_ptr<NodeInterface>> makeChildren(const Scenario& scenario, uint64_t& counter) {
+    std::vector<std::shared_ptr<NodeInterface>> children;
+    for (size_t i = 0; i < scenario.children.size(); ++i) {
+        const ChildProfile& profile = scenario.children[i];
+        children.emplace_back(std::make_shared<WorkLeafNode>("child" + std::to_string(i), i + 1,
+                                                             profile.success_probability, profile.work, counter));
+    }
+    return children;
+}
+
+void measure(const char* scenario, const char* mode, NodeInterface& root, uint32_t decisions,
+             const uint64_t& counter) {
+    const uint64_t ticks_before = counter;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t decision = 0; decision < decisions; ++decision) {
+        // EAGER mode: every tick of the root is a decision.
+        root.tick();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    const double child_ticks = static_cast<double>(counter - ticks_before);
+    std::cout << scenario << "," << mode << "," << decisions << "," << child_ticks / decisions << "," << ns / decisions
+              << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const uint32_t decisions = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 100000;
+    const uint32_t work = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 1000;
+
+    const std::vector<Scenario> scenarios{
+        // Expensive alternatives written first, the cheap reliable one last.
+        {"unreliable_first", {{0.3, work}, {0.3, work}, {0.3, work}, {0.3, work}, {0.95, work / 100}}},
+        // Every child costs one tick, but the reliable one costs far more time.
+        {"slow_reliable_first", {{0.9, work}, {0.6, work / 100}, {0.6, work / 100}}},
+    };
+
+    std::cout << "scenario,mode,decisions,child_ticks_per_decision,ns_per_decision" << std::endl;
+    for (const Scenario& scenario : scenarios) {
+        {
+            uint64_t counter = 0;
+            FallbackNode root("fallback", makeChildren(scenario, counter), TickMode::EAGER);
+            measure(scenario.name, "fallback", root, decisions, counter);
+        }
+        {
+            uint64_t counter = 0;
+            AdaptiveFallbackNode root("adaptive", makeChildren(scenario, counter), {}, TickMode::EAGER);
+            measure(scenario.name, "adaptive_ticks", root, decisions, counter);
+        }
+        {
+            uint64_t counter = 0;
+            AdaptiveFallbackOptions options;
+            options.measure_time = true;
+            AdaptiveFallbackNode root("adaptive", makeChildren(scenario, counter), options, TickMode::EAGER);
+            measure(scenario.name, "adaptive_time", root, decisions, counter);
+        }
+    }
+    return 0;
+}
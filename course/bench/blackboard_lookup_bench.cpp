@@ -0,0 +1,86 @@
+/**
+ * @file blackboard_lookup_bench.cpp
+ * @brief Compares the throwing and the non-throwing lookups of Blackboard and Any,
+ *        for hits, missing keys and type mismatches.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+constexpr uint32_t kIterations = 200000;
+
+template <typename Function>
+double nsPerCall(Function function) {
+    uint64_t found = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kIterations; ++i) {
+        found += function() ? 1 : 0;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    // Keeps the loop from being optimized away.
+    if (found == kIterations + 1) {
+        std::cout << found;
+    }
+    return std::chrono::duration<double, std::nano>(end - start).count() / kIterations;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    Blackboard blackboard;
+    for (int i = 0; i < 64; ++i) {
+        blackboard.set("key_" + std::to_string(i), Any(static_cast<double>(i)));
+    }
+    const std::string hit_key = "key_42";
+    const std::string miss_key = "key_missing";
+
+    std::cout << "case,throwing_ns,non_throwing_ns" << std::endl;
+
+    std::cout << "blackboard_hit,"
+              << nsPerCall([&]() { return Any(blackboard.get(hit_key)).get<double>() > 0.0; }) << ","
+              << nsPerCall([&]() {
+                     const double* value = blackboard.tryGet<double>(hit_key);
+                     return (value != nullptr) && (*value > 0.0);
+                 })
+              << std::endl;
+
+    std::cout << "blackboard_miss," << nsPerCall([&]() {
+        try {
+            return !blackboard.get(miss_key).empty();
+        } catch (const std::out_of_range&) {
+            return false;
+        }
+    }) << "," << nsPerCall([&]() { return blackboard.tryGet<double>(miss_key) != nullptr; })
+              << std::endl;
+
+    Any any_double(1.0);
+    std::cout << "any_type_mismatch," << nsPerCall([&]() {
+        try {
+            return any_double.get<int>() > 0;
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+    }) << "," << nsPerCall([&]() { return any_double.tryGet<int>() != nullptr; })
+              << std::endl;
+    return 0;
+}
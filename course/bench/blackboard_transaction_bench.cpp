@@ -0,0 +1,73 @@
+/**
+ * @file blackboard_transaction_bench.cpp
+ * @brief Cost of updating several related keys of a blackboard: one set per key against a
+ *        transaction reused every tick, for blackboards of increasing size.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Challenge includes
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/BlackboardTransaction.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+constexpr uint32_t kUpdates = 200000;
+
+template <typename Function>
+double nsPerUpdate(Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t update = 0; update < kUpdates; ++update) {
+        function(update);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / kUpdates;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    // Names as nodes usually build them, longer than the small string buffer.
+    const std::array<std::string, 4> keys = {"robot/localization/pose", "robot/localization/covariance",
+                                             "robot/localization/stamp", "robot/localization/frame"};
+
+    std::cout << "blackboard_keys,updated_keys,set_per_key_ns,transaction_ns" << std::endl;
+    for (const int size : {16, 256, 4096}) {
+        Blackboard blackboard;
+        for (int key = 0; key < size; ++key) {
+            blackboard.set("robot/other/key_" + std::to_string(key), 0.0);
+        }
+
+        const double set_ns = nsPerUpdate([&](uint32_t update) {
+            for (const auto& key : keys) {
+                blackboard.set(key, static_cast<double>(update));
+            }
+        });
+
+        BlackboardTransaction transaction(blackboard);
+        const double transaction_ns = nsPerUpdate([&](uint32_t update) {
+            for (const auto& key : keys) {
+                transaction.set(key, static_cast<double>(update));
+            }
+            transaction.commit();
+        });
+
+        std::cout << size << "," << keys.size() << "," << set_ns << "," << transaction_ns << std::endl;
+    }
+    return 0;
+}
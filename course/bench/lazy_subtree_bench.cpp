@@ -0,0 +1,167 @@
+/**
+ * @file lazy_subtree_bench.cpp
+ * @brief Compares building a catalogue of subtrees upfront against materializing them
+ *        lazily through LazySubtreeNode, when only a few of them are ever ticked.
+ *        Construction time, heap footprint and the cost of the first ticks are printed as CSV.
+ *
+ *        Usage: lazy_subtree_bench [subtrees] [active] [depth] [fanout]
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// System includes
+#include <malloc.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/NodeFactory.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/LazySubtreeNode.hpp"
+#include "BehaviorTree/TreeDescription.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+/** @brief Leaf that always returns the same result. */
+class ConstantLeafNode : public NodeInterface {
+   public:
+    ConstantLeafNode(const std::string& name, NodeResult result) : NodeInterface(name), result_{result} {}
+    NodeResult tick() override { return result_; }
+
+   private:
+    NodeResult result_;
+};
+
+/** @brief Bytes allocated on the heap and in use. */
+size_t heapInUse() {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/** @brief Resident set size of the process in KiB. */
+size_t residentKiB() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return resident_pages * static_cast<size_t>(::sysconf(_SC_PAGESIZE)) / 1024;
+}
+
+/** @brief Describes a subtree of alternating fallbacks and sequences, leaves return result. */
+NodeDescription describe(const std::string& name, uint32_t depth, uint32_t fanout, const std::string& result,
+                         size_t& nodes) {
+    ++nodes;
+    if (depth == 0) {
+        return NodeDescription{"Leaf", name, {{"result", result}}, {}};
+    }
+    NodeDescription description{(depth % 2) != 0 ? "Sequence" : "Fallback", name, {}, {}};
+    for (uint32_t i = 0; i < fanout; ++i) {
+        description.children.emplace_back(describe(name + "/" + std::to_string(i), depth - 1, fanout, result, nodes));
+    }
+    return description;
+}
+
+struct Measurement {
+    double build_ms;
+    size_t heap_bytes;
+    size_t rss_kib;
+    double first_tick_us;
+    double tick_ns;
+};
+
+/** @brief Builds the root over the catalogue and ticks it. */
+template <typename MakeChild>
+Measurement measure(size_t subtrees, uint32_t ticks, MakeChild make_child) {
+    Measurement measurement{};
+    const size_t heap_before = heapInUse();
+    const size_t rss_before = residentKiB();
+    const auto build_start = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<NodeInterface>> children;
+    children.reserve(subtrees);
+    for (size_t i = 0; i < subtrees; ++i) {
+        children.emplace_back(make_child(i));
+    }
+    FallbackNode root("root", children);
+    const auto build_end = std::chrono::steady_clock::now();
+    measurement.build_ms = std::chrono::duration<double, std::milli>(build_end - build_start).count();
+
+    // The first tick pays for the subtrees that are materialized.
+    root.tick();
+    const auto first_tick_end = std::chrono::steady_clock::now();
+    measurement.first_tick_us = std::chrono::duration<double, std::micro>(first_tick_end - build_end).count();
+    measurement.heap_bytes = heapInUse() - heap_before;
+    measurement.rss_kib = residentKiB() - rss_before;
+
+    for (uint32_t i = 0; i < ticks; ++i) {
+        root.tick();
+    }
+    const auto tick_end = std::chrono::steady_clock::now();
+    measurement.tick_ns = std::chrono::duration<double, std::nano>(tick_end - first_tick_end).count() / ticks;
+    return measurement;
+}
+
+void print(const char* mode, size_t subtrees, size_t active, size_t nodes, const Measurement& measurement) {
+    std::cout << mode << "," << subtrees << "," << active << "," << nodes << "," << measurement.build_ms << ","
+              << measurement.first_tick_us << "," << measurement.heap_bytes << "," << measurement.rss_kib << ","
+              << measurement.tick_ns << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t subtrees = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 2000;
+    const size_t active = argc > 2 ? static_cast<size_t>(std::atoi(argv[2])) : 10;
+    const uint32_t depth = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 3;
+    const uint32_t fanout = argc > 4 ? static_cast<uint32_t>(std::atoi(argv[4])) : 4;
+    const uint32_t ticks = 10000;
+
+    auto node_factory = std::make_shared<NodeFactory>();
+    node_factory->registerBuilder("Leaf", [](const NodeDescription& description,
+                                             std::vector<std::shared_ptr<NodeInterface>> children) {
+        (void)children;
+        const NodeResult result =
+            description.parameters.at("result") == "SUCCESS" ? NodeResult::SUCCESS : NodeResult::FAILURE;
+        return std::make_shared<ConstantLeafNode>(description.name, result);
+    });
+
+    // Every subtree fails but the last active one, so the root fallback only reaches the active ones.
+    size_t nodes = 0;
+    std::vector<std::shared_ptr<const NodeDescription>> catalogue;
+    catalogue.reserve(subtrees);
+    for (size_t i = 0; i < subtrees; ++i) {
+        const std::string result = ((i + 1) == active) ? "SUCCESS" : "FAILURE";
+        const std::string name = "subtree" + std::to_string(i);
+        catalogue.emplace_back(std::make_shared<const NodeDescription>(describe(name, depth, fanout, result, nodes)));
+    }
+
+    std::cout << "mode,subtrees,active,catalogue_nodes,build_ms,first_tick_us,heap_bytes,rss_kib,ns_per_tick"
+              << std::endl;
+    print("eager", subtrees, active, nodes, measure(subtrees, ticks, [&](size_t i) {
+              return node_factory->buildTree(*catalogue[i]);
+          }));
+    print("lazy", subtrees, active, nodes, measure(subtrees, ticks, [&](size_t i) {
+              return std::make_shared<LazySubtreeNode>("lazy" + std::to_string(i), catalogue[i], node_factory);
+          }));
+    return 0;
+}
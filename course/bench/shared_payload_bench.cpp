@@ -0,0 +1,123 @@
+/**
+ * @file shared_payload_bench.cpp
+ * @brief A producer stores a 10 MB buffer in the blackboard every cycle and several readers
+ *        read it. Compares storing and reading it by value against publishing a shared
+ *        immutable payload and reading views of it. Time per cycle and heap footprint are
+ *        printed as CSV.
+ *
+ *        Usage: shared_payload_bench [payload_mb] [readers] [cycles]
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// System includes
+#include <malloc.h>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+using Buffer = std::vector<uint8_t>;
+
+/** @brief Bytes allocated on the heap and in use. */
+size_t heapInUse() {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+struct Measurement {
+    double cycle_ms;
+    size_t peak_heap_bytes;
+    uint64_t checksum;
+};
+
+/**
+ * @brief Runs the cycles: produce, store, read from every reader while all of them hold
+ *        what they read.
+ */
+template <typename Store, typename Read>
+Measurement measure(size_t payload_bytes, size_t readers, uint32_t cycles, Store store, Read read) {
+    Measurement measurement{};
+    const size_t heap_before = heapInUse();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t cycle = 0; cycle < cycles; ++cycle) {
+        store(Buffer(payload_bytes, static_cast<uint8_t>(cycle)));
+        auto held = read(readers);
+        measurement.peak_heap_bytes = std::max(measurement.peak_heap_bytes, heapInUse() - heap_before);
+        for (const auto& value : held) {
+            measurement.checksum += (*value)[payload_bytes / 2];
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    measurement.cycle_ms = std::chrono::duration<double, std::milli>(end - start).count() / cycles;
+    return measurement;
+}
+
+void print(const char* mode, size_t payload_mb, size_t readers, const Measurement& measurement) {
+    std::cout << mode << "," << payload_mb << "," << readers << "," << measurement.cycle_ms << ","
+              << measurement.peak_heap_bytes / (1024 * 1024) << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t payload_mb = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10;
+    const size_t readers = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 4;
+    const uint32_t cycles = (argc > 3) ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 20;
+    const size_t payload_bytes = payload_mb * 1024 * 1024;
+
+    std::cout << "mode,payload_mb,readers,ms_per_cycle,peak_heap_mb" << std::endl;
+
+    {
+        // Before: set copies the buffer into the blackboard, every get copies it out.
+        Blackboard blackboard;
+        const auto measurement = measure(
+            payload_bytes, readers, cycles, [&](Buffer buffer) { blackboard.set("cloud", Any(buffer)); },
+            [&](size_t count) {
+                std::vector<std::unique_ptr<Buffer>> held;
+                for (size_t reader = 0; reader < count; ++reader) {
+                    held.push_back(std::make_unique<Buffer>(Any(blackboard.get("cloud")).get<Buffer>()));
+                }
+                return held;
+            });
+        print("by_value", payload_mb, readers, measurement);
+    }
+    {
+        // After: the buffer is published once, readers hold views of it.
+        Blackboard blackboard;
+        const auto measurement = measure(
+            payload_bytes, readers, cycles,
+            [&](Buffer buffer) { blackboard.publish("cloud", std::make_shared<const Buffer>(std::move(buffer))); },
+            [&](size_t count) {
+                std::vector<std::shared_ptr<const Buffer>> held;
+                for (size_t reader = 0; reader < count; ++reader) {
+                    held.push_back(blackboard.view<Buffer>("cloud"));
+                }
+                return held;
+            });
+        print("shared", payload_mb, readers, measurement);
+    }
+    return 0;
+}
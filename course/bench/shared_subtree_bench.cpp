@@ -0,0 +1,146 @@
+/**
+ * @file shared_subtree_bench.cpp
+ * @brief Compares the memory footprint and tick cost of many copies of the same subtree
+ *        built from nodes against as many SubtreeInstanceNode sharing one SharedSubtree.
+ *        The results are printed as CSV.
+ *
+ *        Usage: shared_subtree_bench [instances] [depth] [fanout]
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// System includes
+#include <malloc.h>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/Nodes/SubtreeInstanceNode.hpp"
+#include "BehaviorTree/SharedSubtree.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+/** @brief Leaf without state: RUNNING on its last child keeps every instance busy. */
+class ConstantLeafNode : public NodeInterface {
+   public:
+    ConstantLeafNode(const std::string& name, NodeResult result) : NodeInterface(name), result_{result} {}
+    NodeResult tick() override { return result_; }
+
+   private:
+    NodeResult result_;
+};
+
+/** @brief Bytes allocated on the heap and in use. */
+size_t heapInUse() {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+NodeResult leafResult(uint32_t child, uint32_t fanout) {
+    return (child + 1 == fanout) ? NodeResult::RUNNING : NodeResult::SUCCESS;
+}
+
+/** @brief Builds the subtree from nodes: sequences and fallbacks alternate by level. */
+std::shared_ptr<NodeInterface> buildNodes(uint32_t depth, uint32_t fanout, NodeResult result, size_t& nodes) {
+    ++nodes;
+    if (depth == 0) {
+        return std::make_shared<ConstantLeafNode>("leaf", result);
+    }
+    std::vector<std::shared_ptr<NodeInterface>> children;
+    for (uint32_t i = 0; i < fanout; ++i) {
+        children.emplace_back(buildNodes(depth - 1, fanout, leafResult(i, fanout), nodes));
+    }
+    if ((depth % 2) != 0) {
+        return std::make_shared<SequenceNode>("sequence", std::move(children));
+    }
+    return std::make_shared<FallbackNode>("fallback", std::move(children));
+}
+
+/** @brief Adds the same subtree to the builder of a shared structure. */
+SharedSubtree::Index buildShared(SharedSubtree::Builder& builder, uint32_t depth, uint32_t fanout, NodeResult result) {
+    if (depth == 0) {
+        return builder.addLeaf(std::make_shared<ConstantLeafNode>("leaf", result));
+    }
+    std::vector<SharedSubtree::Index> children;
+    for (uint32_t i = 0; i < fanout; ++i) {
+        children.emplace_back(buildShared(builder, depth - 1, fanout, leafResult(i, fanout)));
+    }
+    if ((depth % 2) != 0) {
+        return builder.addSequence(children);
+    }
+    return builder.addFallback(children);
+}
+
+/** @brief Creates the instances, then ticks all of them. */
+template <typename MakeInstance>
+void measure(const char* mode, size_t instances, size_t nodes, uint32_t ticks, MakeInstance make_instance) {
+    const size_t heap_before = heapInUse();
+    const auto build_start = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<NodeInterface>> roots;
+    roots.reserve(instances);
+    for (size_t i = 0; i < instances; ++i) {
+        roots.emplace_back(make_instance());
+    }
+    const auto build_end = std::chrono::steady_clock::now();
+    const size_t heap_bytes = heapInUse() - heap_before;
+
+    for (uint32_t tick = 0; tick < ticks; ++tick) {
+        for (auto& root : roots) {
+            root->tick();
+        }
+    }
+    const auto tick_end = std::chrono::steady_clock::now();
+
+    const double build_ms = std::chrono::duration<double, std::milli>(build_end - build_start).count();
+    const double ticked = static_cast<double>(ticks) * static_cast<double>(instances);
+    const double tick_ns = std::chrono::duration<double, std::nano>(tick_end - build_end).count() / ticked;
+    std::cout << mode << "," << instances << "," << nodes << "," << build_ms << "," << heap_bytes << ","
+              << static_cast<double>(heap_bytes) / instances << "," << tick_ns << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t instances = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 10000;
+    const uint32_t depth = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 3;
+    const uint32_t fanout = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 4;
+    const uint32_t ticks = 100;
+
+    size_t nodes = 0;
+    buildNodes(depth, fanout, NodeResult::RUNNING, nodes);
+
+    std::cout << "mode,instances,nodes_per_subtree,build_ms,heap_bytes,bytes_per_instance,ns_per_instance_tick"
+              << std::endl;
+    measure("copies", instances, nodes, ticks, [&]() {
+        size_t ignored = 0;
+        return buildNodes(depth, fanout, NodeResult::RUNNING, ignored);
+    });
+
+    // The structure is built once, outside of the measurement of each instance.
+    SharedSubtree::Builder builder;
+    const auto subtree = builder.build(buildShared(builder, depth, fanout, NodeResult::RUNNING));
+    measure("shared", instances, nodes, ticks,
+            [&]() { return std::make_shared<SubtreeInstanceNode>("instance", subtree); });
+    return 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file tick_mode_bench.cpp
+ * @brief Compares the ticks and time needed to decide a tree in STEP and EAGER modes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+/** @brief Leaf node that decides instantaneously. */
+class ConditionNode : public NodeInterface {
+   public:
+    ConditionNode(const std::string& name, NodeResult result) : NodeInterface(name), result_{result} {}
+    NodeResult tick() override { return result_; }
+
+   private:
+    NodeResult result_;
+};
+
+struct Measure {
+    uint32_t ticks;
+    double micros;
+};
+
+/**
+ * @brief Builds a composite of `width` instantaneous conditions and measures how
+ *        many ticks and how much time BTManager::run needs to decide it.
+ *          - Sequence: every condition succeeds.
+ *          - Fallback: every condition but the last one fails.
+ */
+template <typename CompositeType>
+Measure measure(TickMode mode, uint32_t width, uint32_t repetitions) {
+    constexpr bool kIsFallback = std::is_same<CompositeType, FallbackNode>::value;
+    Measure result{0, 0.0};
+    for (uint32_t repetition = 0; repetition < repetitions; ++repetition) {
+        BTManager manager(mode);
+        std::vector<std::shared_ptr<NodeInterface>> conditions;
+        for (uint32_t i = 0; i < width; ++i) {
+            const bool fails = kIsFallback && (i != width - 1);
+            conditions.emplace_back(manager.makeNode<ConditionNode>(
+                "condition_" + std::to_string(i), fails ? NodeResult::FAILURE : NodeResult::SUCCESS));
+        }
+        manager.makeNode<CompositeType>("root", conditions);
+
+        const auto start = std::chrono::steady_clock::now();
+        manager.run(std::numeric_limits<uint32_t>::max());
+        const auto end = std::chrono::steady_clock::now();
+        result.ticks = manager.getLastTickCount();
+        result.micros += std::chrono::duration<double, std::micro>(end - start).count();
+    }
+    result.micros /= repetitions;
+    return result;
+}
+
+template <typename CompositeType>
+void report(const std::string& tree, uint32_t width, uint32_t repetitions) {
+    const Measure step = measure<CompositeType>(TickMode::STEP, width, repetitions);
+    const Measure eager = measure<CompositeType>(TickMode::EAGER, width, repetitions);
+    std::cout << tree << "," << width << "," << step.ticks << "," << eager.ticks << "," << step.micros << ","
+              << eager.micros << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    constexpr uint32_t kRepetitions = 20;
+
+    std::cout << "tree,width,step_ticks,eager_ticks,step_us,eager_us" << std::endl;
+    for (uint32_t width : {4u, 16u, 64u, 256u, 1024u}) {
+        report<SequenceNode>("sequence", width, kRepetitions);
+        report<FallbackNode>("fallback", width, kRepetitions);
+    }
+    return 0;
+}
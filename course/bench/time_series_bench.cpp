@@ -0,0 +1,91 @@
+/**
+ * @file time_series_bench.cpp
+ * @brief Keeps the last N poses and their moving average, either by copying a vector in and
+ *        out of the blackboard on every update or with a time-series entry.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/TimeSeries.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+constexpr uint32_t kUpdates = 200000;
+
+template <typename Function>
+double nsPerUpdate(Function function) {
+    double total = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t update = 0; update < kUpdates; ++update) {
+        total += function(update);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    // Keeps the loop from being optimized away.
+    if (total < 0.0) {
+        std::cout << total;
+    }
+    return std::chrono::duration<double, std::nano>(end - start).count() / kUpdates;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    std::cout << "history,vector_copy_ns,time_series_ns" << std::endl;
+    for (const size_t history : {10, 100, 1000}) {
+        const auto epoch = Clock::TimePoint{};
+
+        // Before: the history is a vector stored in an Any, copied out and back in.
+        Blackboard blackboard;
+        blackboard.set("poses", Any(std::vector<double>{}));
+        const double vector_ns = nsPerUpdate([&](uint32_t update) {
+            std::vector<double> poses = Any(blackboard.get("poses")).get<std::vector<double>>();
+            if (poses.size() == history) {
+                poses.erase(poses.begin());
+            }
+            poses.push_back(static_cast<double>(update));
+            blackboard.set("poses", Any(poses));
+            std::vector<double> read = Any(blackboard.get("poses")).get<std::vector<double>>();
+            // Same aggregates as TimeSeries::summarizeLatest.
+            TimeSeriesSummary summary{0, 0.0, 0.0, read.front(), read.front()};
+            for (const double pose : read) {
+                summary.min = std::min(summary.min, pose);
+                summary.max = std::max(summary.max, pose);
+                summary.sum += pose;
+                ++summary.count;
+            }
+            return summary.sum / static_cast<double>(summary.count) + summary.max - summary.min;
+        });
+
+        // After: the writer appends in place, the reader aggregates in place.
+        auto writer = blackboard.registerTimeSeries<double>("pose_history", history);
+        const TimeSeries<double>* reader = blackboard.tryGetTimeSeries<double>("pose_history");
+        const double time_series_ns = nsPerUpdate([&](uint32_t update) {
+            writer->append(static_cast<double>(update), epoch + std::chrono::milliseconds(update));
+            const TimeSeriesSummary summary = reader->summarizeLatest(history);
+            return summary.mean + summary.max - summary.min;
+        });
+
+        std::cout << history << "," << vector_ns << "," << time_series_ns << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file tree_scaling_bench.cpp
+ * @brief Measures construction time, memory footprint and tick throughput of
+ *        generated trees as their size grows. The results are printed as CSV.
+ *
+ *        Usage: tree_scaling_bench [max_depth] [fanout] [ticks] [seed]
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// System includes
+#include <malloc.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TreeGenerator.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+/** @brief Bytes allocated on the heap and in use. */
+size_t heapInUse() {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/** @brief Resident set size of the process in KiB. */
+size_t residentKiB() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return resident_pages * static_cast<size_t>(::sysconf(_SC_PAGESIZE)) / 1024;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const uint32_t max_depth = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 10;
+    const uint32_t fanout = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 4;
+    const uint32_t ticks = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 100000;
+    const uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1;
+
+    std::cout << "depth,fanout,nodes,leaves,build_ms,heap_bytes,bytes_per_node,rss_kib,ticks,ns_per_tick,"
+                 "ticks_per_second"
+              << std::endl;
+    for (uint32_t depth = 1; depth <= max_depth; ++depth) {
+        TreeGeneratorConfig config;
+        config.seed = seed;
+        config.depth = depth;
+        config.min_fanout = fanout;
+        config.max_fanout = fanout;
+        // RUNNING leaves keep the ticks going down to the leaves instead of finishing early.
+        config.leaf_success_probability = 0.45;
+        config.leaf_failure_probability = 0.45;
+
+        const size_t heap_before = heapInUse();
+        const size_t rss_before = residentKiB();
+        const auto build_start = std::chrono::steady_clock::now();
+        {
+            BTManager manager;
+            const GeneratedTreeInfo info = TreeGenerator(config).generate(manager);
+            const auto build_end = std::chrono::steady_clock::now();
+            const size_t heap_bytes = heapInUse() - heap_before;
+            const size_t rss_kib = residentKiB() - rss_before;
+
+            // run stops when the tree decides, so it is called until all the ticks are spent.
+            uint64_t ticked = 0;
+            const auto tick_start = std::chrono::steady_clock::now();
+            while (ticked < ticks) {
+                manager.run(static_cast<uint32_t>(ticks - ticked));
+                ticked += manager.getLastTickCount();
+            }
+            const auto tick_end = std::chrono::steady_clock::now();
+
+            const double build_ms = std::chrono::duration<double, std::milli>(build_end - build_start).count();
+            const double tick_ns = std::chrono::duration<double, std::nano>(tick_end - tick_start).count() / ticked;
+            std::cout << depth << "," << fanout << "," << info.nodes << "," << info.leaves << "," << build_ms << ","
+                      << heap_bytes << "," << static_cast<double>(heap_bytes) / info.nodes << "," << rss_kib << ","
+                      << ticked << "," << tick_ns << "," << 1e9 / tick_ns << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file utility_selector_bench.cpp
+ * @brief Measures the cost of a tick of UtilitySelectorNode as the amount of
+ *        candidates grows, compared with scoring every candidate through a virtual call.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/UtilitySelectorNode.hpp"
+
+namespace {
+
+using namespace behavior_tree;
+
+constexpr size_t kInputs = 8;
+
+class ActionNode : public NodeInterface {
+   public:
+    explicit ActionNode(const std::string& name) : NodeInterface(name) {}
+    NodeResult tick() override { return NodeResult::RUNNING; }
+};
+
+/** @brief Baseline: one virtual call per candidate. */
+class Scorer {
+   public:
+    virtual ~Scorer() = default;
+    virtual float score(const std::vector<float>& inputs) const = 0;
+};
+
+class LinearScorer : public Scorer {
+   public:
+    explicit LinearScorer(const UtilityScoring& scoring) : scoring_{scoring} {}
+    float score(const std::vector<float>& inputs) const override {
+        float result = scoring_.bias;
+        for (size_t input = 0; input < inputs.size(); ++input) {
+            result += scoring_.weights[input] * inputs[input];
+        }
+        return result;
+    }
+
+   private:
+    UtilityScoring scoring_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    auto blackboard = std::make_shared<Blackboard>();
+    std::vector<std::string> keys;
+    for (size_t input = 0; input < kInputs; ++input) {
+        keys.emplace_back("input_" + std::to_string(input));
+        blackboard->set(keys.back(), Any(static_cast<double>(distribution(random))));
+    }
+
+    std::cout << "candidates,inputs,selector_ns_per_tick,selector_ns_per_candidate,virtual_ns_per_tick,"
+                 "virtual_ns_per_candidate"
+              << std::endl;
+    for (size_t candidates : {10u, 100u, 1000u, 10000u}) {
+        std::vector<std::shared_ptr<NodeInterface>> children;
+        std::vector<UtilityScoring> scorings;
+        std::vector<std::unique_ptr<Scorer>> scorers;
+        for (size_t candidate = 0; candidate < candidates; ++candidate) {
+            children.emplace_back(std::make_shared<ActionNode>("action_" + std::to_string(candidate)));
+            UtilityScoring scoring{distribution(random), {}};
+            for (size_t input = 0; input < kInputs; ++input) {
+                scoring.weights.emplace_back(distribution(random));
+            }
+            scorers.emplace_back(std::make_unique<LinearScorer>(scoring));
+            scorings.emplace_back(std::move(scoring));
+        }
+        UtilitySelectorNode selector("selector", blackboard, keys, children, scorings);
+
+        const uint32_t ticks = static_cast<uint32_t>(2000000 / candidates) + 10;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t tick = 0; tick < ticks; ++tick) {
+            selector.tick();
+        }
+        auto end = std::chrono::steady_clock::now();
+        const double selector_ns = std::chrono::duration<double, std::nano>(end - start).count() / ticks;
+
+        // Same work through virtual calls: read the inputs, score, pick the best, tick it.
+        std::vector<float> inputs(kInputs);
+        size_t selected = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t tick = 0; tick < ticks; ++tick) {
+            for (size_t input = 0; input < kInputs; ++input) {
+                inputs[input] = static_cast<float>(*blackboard->tryGet<double>(keys[input]));
+            }
+            float best = scorers[0]->score(inputs);
+            selected = 0;
+            for (size_t candidate = 1; candidate < candidates; ++candidate) {
+                const float score = scorers[candidate]->score(inputs);
+                if (score > best) {
+                    best = score;
+                    selected = candidate;
+                }
+            }
+            children[selected]->tick();
+        }
+        end = std::chrono::steady_clock::now();
+        const double virtual_ns = std::chrono::duration<double, std::nano>(end - start).count() / ticks;
+
+        if (selected != selector.getSelected()) {
+            std::cerr << "selector and baseline disagree" << std::endl;
+            return 1;
+        }
+        std::cout << candidates << "," << kInputs << "," << selector_ns << "," << selector_ns / candidates << ","
+                  << virtual_ns << "," << virtual_ns / candidates << std::endl;
+    }
+    return 0;
+}
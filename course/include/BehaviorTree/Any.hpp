@@ -12,11 +12,14 @@
 #pragma once
 
 // Standard include
-#include <iostream>
+#include <atomic>
 #include <memory>
+#include <stdexcept>
 #include <string>
-#include <typeindex>
-#include <typeinfo>
+#include <utility>
+
+// Challenge includes
+#include "BehaviorTree/NodeUtils.hpp"
 
 namespace behavior_tree {
 
@@ -37,12 +40,52 @@ class Any {
      * @brief Populates the object with the new value.
      *        The holder can inherit from PlaceHolder and hence,
      *        store any type of value.
+     *        When it already holds a T that no copy nor view shares, the value is assigned
+     *        in place and nothing is allocated.
      * @param value value to store
      */
     template <typename T>
     void set(const T &value) {
+        if (is<T>() && !shared_ && ownsHolder()) {
+            static_cast<Holder<T> &>(*content_type_).value_ = value;
+            return;
+        }
         content_type_ = std::make_shared<Holder<T>>(value);
-        place_holder_type_ = std::make_shared<std::type_index>(typeid(value));
+        place_holder_type_ = typeId<T>();
+        shared_ = false;
+    }
+
+    /**
+     * @brief Stores an immutable payload without copying it, meant for large values. The
+     *        payload is released when the last Any and the last view holding it are gone.
+     * @param payload payload to store, it can't be nullptr.
+     */
+    template <typename T>
+    void share(std::shared_ptr<const T> payload) {
+        if (payload == nullptr) {
+            BEHAVIOR_TREE_THROW(std::invalid_argument("payload cannot be nullptr"));
+        }
+        content_type_ = std::make_shared<SharedHolder<T>>(std::move(payload));
+        place_holder_type_ = typeId<T>();
+        shared_ = true;
+    }
+
+    /**
+     * @brief Returns a view of the stored value that keeps it alive, without copying it.
+     *        Later calls to set, or writes through tryGet, don't modify the value seen
+     *        through the view: both copy the value while a view shares it.
+     * @return std::shared_ptr<const T> the view, nullptr when it is empty or it holds another type.
+     */
+    template <typename T>
+    std::shared_ptr<const T> view() const {
+        if (!is<T>()) {
+            return nullptr;
+        }
+        if (shared_) {
+            return static_cast<const SharedHolder<T> &>(*content_type_).payload_;
+        }
+        // Shares the ownership of the holder, so set copies on write while the view lives.
+        return std::shared_ptr<const T>(content_type_, &static_cast<const Holder<T> &>(*content_type_).value_);
     }
 
     /**
@@ -54,30 +97,121 @@ class Any {
     template <typename T>
     T get() {
         if (!content_type_) {
-            throw std::runtime_error("Cannot read without setting a value before.");
+            BEHAVIOR_TREE_THROW(std::runtime_error("Cannot read without setting a value before."));
+        }
+        if (place_holder_type_ != typeId<T>()) {
+            BEHAVIOR_TREE_THROW(std::runtime_error("Casting object to a different type than the original."));
+        }
+        // Shared payloads are only reachable through the const overload.
+        return *std::as_const(*this).tryGet<T>();
+    }
+
+    /**
+     * @brief Returns a pointer to the stored value, without throwing. When the value is
+     *        shared with copies of the object, it is copied first, so writing through the
+     *        pointer never changes them.
+     * @return T* pointer to the value, nullptr when it is empty, it holds another type or it
+     *         holds a shared payload, which is immutable.
+     */
+    template <typename T>
+    T *tryGet() {
+        if (!is<T>() || shared_) {
+            return nullptr;
+        }
+        if (!ownsHolder()) {
+            content_type_ = std::make_shared<Holder<T>>(static_cast<const Holder<T> &>(*content_type_).value_);
+        }
+        return &static_cast<Holder<T> &>(*content_type_).value_;
+    }
+
+    /**
+     * @brief Returns a pointer to the stored value, without throwing.
+     * @return const T* pointer to the value, nullptr when it is empty or it holds another type.
+     */
+    template <typename T>
+    const T *tryGet() const {
+        if (!is<T>()) {
+            return nullptr;
         }
-        if (*place_holder_type_ != typeid(T)) {
-            throw std::runtime_error("Casting object to a different type than the original.");
+        if (shared_) {
+            return static_cast<const SharedHolder<T> &>(*content_type_).payload_.get();
         }
-        return static_cast<Holder<T> &>(*content_type_).value_;
+        return &static_cast<const Holder<T> &>(*content_type_).value_;
+    }
+
+    /**
+     * @brief Returns true when it holds a value of type T.
+     */
+    template <typename T>
+    bool is() const {
+        return content_type_ && (place_holder_type_ == typeId<T>());
+    }
+
+    /**
+     * @brief Exchanges the values of two objects, without copying nor allocating.
+     */
+    void swap(Any &other) noexcept {
+        content_type_.swap(other.content_type_);
+        std::swap(place_holder_type_, other.place_holder_type_);
+        std::swap(shared_, other.shared_);
     }
 
+    /**
+     * @brief Returns true when it holds a shared payload.
+     */
+    bool isShared() const { return shared_; }
+
+    /**
+     * @brief Returns true when it doesn't hold any value.
+     */
+    bool empty() const { return !content_type_; }
+
+    /**
+     * @brief Returns the identifier of the type stored, nullptr when it is empty.
+     */
+    TypeId type() const { return place_holder_type_; }
+
    private:
+    /**
+     * @brief Returns true when no other copy nor view shares the holder, so its value can be
+     *        written in place. Copies may be dropped by other threads (e.g. those of
+     *        Blackboard::getMany): the fence orders their last reads of the value before the
+     *        write, since use_count is a relaxed load.
+     */
+    bool ownsHolder() const {
+#ifdef BEHAVIOR_TREE_THREAD_SANITIZER
+        // ThreadSanitizer would report the fenced write as a race, so holders are never reused.
+        return false;
+#else
+        if (content_type_.use_count() != 1) {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+#endif
+    }
+
     struct PlaceHolder {
         virtual ~PlaceHolder() = default;
     };
     template <typename T>
     struct Holder : public PlaceHolder {
         template <typename U>
-        explicit Holder(U &&value) {
-            value_ = value;
-        }
+        explicit Holder(U &&value) : value_(std::forward<U>(value)) {}
 
         T value_;
     };
+    template <typename T>
+    struct SharedHolder : public PlaceHolder {
+        explicit SharedHolder(std::shared_ptr<const T> payload) : payload_(std::move(payload)) {}
+
+        std::shared_ptr<const T> payload_;
+    };
 
     std::shared_ptr<PlaceHolder> content_type_;
-    std::shared_ptr<std::type_index> place_holder_type_;
+    TypeId place_holder_type_ = nullptr;
+    // The value is held by a SharedHolder.
+    bool shared_ = false;
 };
 
-}  // namespace behavior_tree
\ No newline at end of file
+}  // namespace behavior_tree
@@ -12,8 +12,14 @@
 #pragma once
 
 // Standard include
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -21,17 +27,33 @@
 // Challenge includes
 #include "BehaviorTree/Blackboard.hpp"
 #include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeProfiler.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/RuntimeStatistics.hpp"
+#include "BehaviorTree/TickObserver.hpp"
 
 namespace behavior_tree {
 class BTManager {
    public:
+    /** @brief Nodes of a tree, by name. */
+    using NodePool = std::map<std::string, std::shared_ptr<NodeInterface>>;
+
     /**
      * @brief Construct a new BTManager object
      *
      */
-    BTManager() {
+    BTManager() : BTManager(TickMode::STEP){};
+
+    /**
+     * @brief Construct a new BTManager object
+     *
+     * @param tick_mode tick mode of the nodes created through makeNode. In STEP, the
+     *        nodes keep the tick mode given to their constructor.
+     */
+    explicit BTManager(TickMode tick_mode) : tick_mode_{tick_mode} {
         blackboard_ = std::make_shared<Blackboard>();
         root_node_name_ = "";
+        last_tick_count_ = 0;
     };
 
     /**
@@ -39,8 +61,15 @@ class BTManager {
      */
     ~BTManager() = default;
 
+    // The nodes keep a pointer to the observers of the manager, and lazy nodes one to the manager.
+    BTManager(const BTManager&) = delete;
+    BTManager& operator=(const BTManager&) = delete;
+
     /**
      * @brief Emplaces a new node into the node_pool.
+     *        An EAGER manager makes the new node EAGER, it can be overridden afterwards
+     *        through NodeInterface::setTickMode. A STEP manager keeps the tick mode given
+     *        to the constructor of the node.
      *
      * @tparam T NodeInterface
      * @param name name of the node to be injected
@@ -55,6 +84,7 @@ class BTManager {
         if (search != node_pool_.end()) {
             throw std::runtime_error("Node name duplicated");
         }
+        registerNode(*new_node);
         // Add the root to the pool.
         node_pool_.emplace(std::make_pair(new_node->getName(), new_node));
         // Store the name of the last node that its emplaced into the map.
@@ -72,6 +102,7 @@ class BTManager {
         NodeResult result = NodeResult::RUNNING;
         uint32_t tick_count = 0;
 
+        installStagedTree();
         if (node_pool_.empty()) {
             throw std::runtime_error("node pool is empty");
         }
@@ -80,19 +111,211 @@ class BTManager {
         auto root_node = node_pool_[root_node_name_];
 
         while ((result == NodeResult::RUNNING) && (max_tick_count > tick_count)) {
-            result = root_node->tick();
+            // A staged tree replaces the current one between two ticks.
+            if (installStagedTree()) {
+                root_node = node_pool_[root_node_name_];
+            }
+            result = root_node->observedTick();
             ++tick_count;
         }
-        if (tick_count == max_tick_count) {
+        last_tick_count_ = tick_count;
+        const bool tick_limit_reached = (tick_count == max_tick_count);
+        if (statistics_ != nullptr) {
+            statistics_->runFinished(result, tick_limit_reached);
+        }
+        if (tick_limit_reached) {
             return NodeResult::FAILURE;
         }
         return result;
     };
 
+    /**
+     * @brief Returns the amount of ticks used by the last call to run.
+     *
+     * @return uint32_t amount of ticks.
+     */
+    uint32_t getLastTickCount() const { return last_tick_count_; }
+
+    /**
+     * @brief Adds an observer that is notified on every tick of the nodes of the pool,
+     *        both the ones already created and the ones created afterwards.
+     *
+     * @param observer observer to be added.
+     */
+    void addTickObserver(std::shared_ptr<TickObserver> observer) {
+        forEachOwnedNode([&observer](NodeInterface& node) { observer->nodeAdded(node); });
+        observers_.add(std::move(observer));
+        forEachOwnedNode([this](NodeInterface& node) { node.setTickObserver(&observers_); });
+    }
+
+    /**
+     * @brief Enables the profiling mode, measuring time and hardware counters per node.
+     *
+     * @return std::shared_ptr<NodeProfiler> profiler that aggregates the measurements.
+     */
+    std::shared_ptr<NodeProfiler> enableProfiling() {
+        auto profiler = std::make_shared<NodeProfiler>();
+        addTickObserver(profiler);
+        return profiler;
+    }
+
+    /**
+     * @brief Enables the runtime statistics. Calling it again returns the same object.
+     *
+     * @return std::shared_ptr<const RuntimeStatistics> statistics, snapshot can be called from any thread.
+     */
+    std::shared_ptr<const RuntimeStatistics> enableStatistics() {
+        if (statistics_ == nullptr) {
+            statistics_ = std::make_shared<RuntimeStatistics>(blackboard_);
+            addTickObserver(statistics_);
+        }
+        return statistics_;
+    }
+
+    /**
+     * @brief Asks every node of the tree to release what it can rebuild on demand
+     *        (e.g. the subtrees of idle LazySubtreeNode). Meant to be called periodically,
+     *        between calls to run.
+     *
+     * @return size_t amount of nodes that released something.
+     */
+    size_t releaseIdleSubtrees() {
+        size_t released = 0;
+        // Lazy nodes may be nested in the subtree of another one. A released subtree is not visited.
+        forEachOwnedNode([&released](NodeInterface& node) {
+            if (node.releaseIdle()) {
+                ++released;
+            }
+        });
+        return released;
+    }
+
+    /**
+     * @brief Returns the blackboard shared by the nodes of the tree.
+     *
+     * @return std::shared_ptr<Blackboard> blackboard.
+     */
+    std::shared_ptr<Blackboard> getBlackboard() const { return blackboard_; }
+
+    /**
+     * @brief Stages a tree that replaces the current one before the next tick. It can be
+     *        called from any thread, while run is executing. A tree staged before the previous
+     *        one was installed replaces it.
+     *        The nodes already owned by the manager keep their id and state, the rest are
+     *        registered as if they were made through makeNode.
+     *        The replaced trees are released by the next call to stageTree (or by the
+     *        destructor), so run doesn't spend time destroying them.
+     *
+     * @param pool every node of the new tree, by name.
+     * @param root_name name of the root of the new tree.
+     */
+    void stageTree(NodePool pool, const std::string& root_name) {
+        if (pool.find(root_name) == pool.end()) {
+            throw std::invalid_argument("Root node is not in the pool");
+        }
+        auto staged = std::make_unique<StagedTree>();
+        staged->pool = std::move(pool);
+        staged->root_name = root_name;
+
+        std::vector<std::unique_ptr<StagedTree>> retired;
+        {
+            std::lock_guard<std::mutex> lock(staged_mutex_);
+            retired.swap(retired_trees_);
+            // A tree that was never installed is simply dropped.
+            retired.emplace_back(std::move(staged_tree_));
+            staged_tree_ = std::move(staged);
+            staged_tree_ready_.store(true, std::memory_order_release);
+        }
+        // The retired trees are destroyed here, on the caller's thread.
+    }
+
+    /**
+     * @brief Returns true when a staged tree is waiting to be installed.
+     */
+    bool hasStagedTree() const { return staged_tree_ready_.load(std::memory_order_acquire); }
+
    private:
-    std::map<std::string, std::shared_ptr<NodeInterface>> node_pool_;
+    /** @brief Tree waiting to be installed, or replaced tree waiting to be released. */
+    struct StagedTree {
+        NodePool pool;
+        std::string root_name;
+    };
+
+    /**
+     * @brief Applies the settings of the manager to a node that it starts owning. Nodes built
+     *        later on by a lazy node are registered through the same function, and keep the id
+     *        the lazy node gives them back when it builds them again.
+     */
+    void registerNode(NodeInterface& node) {
+        // Nodes are STEP unless told otherwise, so STEP would only undo an explicit EAGER.
+        if (tick_mode_ == TickMode::EAGER) {
+            node.setTickMode(tick_mode_);
+        }
+        if (node.getId() == NodeInterface::kInvalidId) {
+            node.setId(next_id_++);
+        }
+        if (!observers_.empty()) {
+            node.setTickObserver(&observers_);
+            observers_.nodeAdded(node);
+        }
+        node.setRegistrar([this](NodeInterface& built) { registerNode(built); });
+    }
+
+    /**
+     * @brief Calls visitor once with every node of the pool and of the subtrees built by lazy nodes.
+     */
+    void forEachOwnedNode(const NodeInterface::Visitor& visitor) {
+        std::set<NodeInterface*> visited;
+        NodeInterface::Visitor visit = [&visit, &visitor, &visited](NodeInterface& node) {
+            // Nodes without id aren't owned by the manager, nor are their children.
+            if ((node.getId() != NodeInterface::kInvalidId) && visited.insert(&node).second) {
+                visitor(node);
+                node.visitChildren(visit);
+            }
+        };
+        for (auto& node : node_pool_) {
+            visit(*node.second);
+        }
+    }
+
+    /**
+     * @brief Swaps the staged tree in, if any. It never waits for the thread that stages.
+     *
+     * @return true when a tree was installed.
+     */
+    bool installStagedTree() {
+        if (!staged_tree_ready_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(staged_mutex_, std::try_to_lock);
+        if (!lock.owns_lock() || (staged_tree_ == nullptr)) {
+            return false;
+        }
+        for (auto& node : staged_tree_->pool) {
+            if (node.second->getId() == NodeInterface::kInvalidId) {
+                registerNode(*node.second);
+            }
+        }
+        std::swap(node_pool_, staged_tree_->pool);
+        std::swap(root_node_name_, staged_tree_->root_name);
+        // The replaced tree is kept until the next stageTree, so it isn't released here.
+        retired_trees_.emplace_back(std::move(staged_tree_));
+        staged_tree_ready_.store(false, std::memory_order_release);
+        return true;
+    }
+
+    NodePool node_pool_;
     std::shared_ptr<Blackboard> blackboard_;
     std::string root_node_name_;
+    TickMode tick_mode_;
+    uint32_t last_tick_count_;
+    TickObserverChain observers_;
+    std::shared_ptr<RuntimeStatistics> statistics_;
+    uint32_t next_id_ = 0;
+    std::mutex staged_mutex_;
+    std::atomic<bool> staged_tree_ready_{false};
+    std::unique_ptr<StagedTree> staged_tree_;
+    std::vector<std::unique_ptr<StagedTree>> retired_trees_;
 };
 
 }  // namespace behavior_tree
\ No newline at end of file
@@ -12,14 +12,32 @@
 #pragma once
 
 // Standard include
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 // Challenge includes
 #include <BehaviorTree/Any.hpp>
+#include <BehaviorTree/TimeSeries.hpp>
 
 namespace behavior_tree {
+
+class BlackboardTransaction;
+
+/**
+ * @brief Values shared by the nodes. It's written and read by the thread that ticks the tree;
+ *        other threads read consistent sets of values through getMany. Keys are never erased.
+ */
 class Blackboard {
    public:
     /**
@@ -35,13 +53,101 @@ class Blackboard {
     ~Blackboard() = default;
 
     /**
-     * @brief Set an object into the blackboard
+     * @brief Set an object into the blackboard. When the key already holds a value of the
+     *        same type, the value is assigned in place and nothing is allocated.
      *
      * @param key key string where the object should be stored
-     * @param object object to be stored.
+     * @param object object to be stored, an Any or a plain value.
+     */
+    template <typename T>
+    void set(std::string_view key, const T& object) {
+        std::lock_guard<std::shared_mutex> lock(mutex_);
+        Any& entry = findOrCreate(key);
+        if constexpr (std::is_same<T, Any>::value) {
+            entry = object;
+        } else {
+            entry.set(object);
+        }
+        write_count_.fetch_add(1, std::memory_order_relaxed);
+        version_.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Publishes an immutable payload, meant for large values such as point clouds or
+     *        images. Nothing is copied, neither now nor when it is read through view.
+     *
+     * @param key key string where the payload should be stored
+     * @param payload payload to be published, it can't be nullptr.
+     */
+    template <typename T>
+    void publish(std::string_view key, std::shared_ptr<const T> payload) {
+        Any object;
+        object.share(std::move(payload));
+        set(key, object);
+    }
+
+    /**
+     * @brief Returns a view of a value that keeps it alive, without copying it. It works
+     *        both for published payloads and for values stored through set.
+     *
+     * @param key string with the value to be viewed
+     * @return std::shared_ptr<const T> the view, nullptr when the key doesn't exist or holds another type.
+     */
+    template <typename T>
+    std::shared_ptr<const T> view(std::string_view key) const {
+        const Any* object = tryGet(key);
+        if (object == nullptr) {
+            return nullptr;
+        }
+        return object->view<T>();
+    }
+
+    /**
+     * @brief Creates a key ahead of time, so writes of values of its type don't allocate.
+     *        Meant to be called while the tree is built. An existing key keeps its value.
+     *
+     * @param key key to be created.
+     * @param initial_value value stored when the key doesn't exist yet.
+     */
+    template <typename T>
+    void registerKey(const std::string& key, const T& initial_value = T{}) {
+        std::lock_guard<std::shared_mutex> lock(mutex_);
+        if (!contains(key)) {
+            database_.emplace(key, Any(initial_value));
+            size_.store(database_.size(), std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Creates a time-series entry: the key holds the history of its samples instead of
+     *        a single value. Meant to be called while the tree is built. The writer keeps the
+     *        returned pointer and appends to it from its own thread, without going through
+     *        the blackboard.
+     *
+     * @param key key to be created.
+     * @param capacity amount of samples kept.
+     * @return std::shared_ptr<TimeSeries<T>> the entry, the existing one when the key already holds one.
      */
-    void set(const std::string& key, const Any& object) {
-        database_[key] = object;
+    template <typename T>
+    std::shared_ptr<TimeSeries<T>> registerTimeSeries(const std::string& key, size_t capacity) {
+        if (const auto* existing = tryGet<std::shared_ptr<TimeSeries<T>>>(key)) {
+            return *existing;
+        }
+        auto time_series = std::make_shared<TimeSeries<T>>(capacity);
+        set(key, time_series);
+        return time_series;
+    }
+
+    /**
+     * @brief Get a time-series entry, without throwing nor allocating.
+     *
+     * @param key key of the entry.
+     * @return const TimeSeries<T>* the entry, nullptr when the key doesn't hold a TimeSeries<T>.
+     */
+    template <typename T>
+    const TimeSeries<T>* tryGetTimeSeries(std::string_view key) const {
+        const auto* time_series = tryGet<std::shared_ptr<TimeSeries<T>>>(key);
+        return (time_series == nullptr) ? nullptr : time_series->get();
     }
 
     /**
@@ -51,8 +157,96 @@ class Blackboard {
      */
     const Any& get(const std::string& key) const { return database_.at(key); }
 
+    /**
+     * @brief Get an object from blackboard, without throwing nor allocating.
+     *
+     * @param key string with the object to be retrieved
+     * @return const Any* pointer to the object, nullptr when the key doesn't exist.
+     */
+    const Any* tryGet(std::string_view key) const {
+        const auto search = database_.find(key);
+        if (search == database_.end()) {
+            return nullptr;
+        }
+        return &search->second;
+    }
+
+    /**
+     * @brief Get a value from blackboard, without throwing nor allocating.
+     *
+     * @param key string with the value to be retrieved
+     * @return const T* pointer to the value, nullptr when the key doesn't exist or holds another type.
+     */
+    template <typename T>
+    const T* tryGet(std::string_view key) const {
+        const Any* object = tryGet(key);
+        if (object == nullptr) {
+            return nullptr;
+        }
+        return object->tryGet<T>();
+    }
+
+    /**
+     * @brief Reads several values at once, as they were after the same write or commit.
+     *        Values are shared, not copied. It can be called from any thread.
+     *
+     * @param keys keys to be read.
+     * @return std::array<Any, N> the values, empty for the keys that don't exist.
+     */
+    template <typename... Keys>
+    std::array<Any, sizeof...(Keys)> getMany(const Keys&... keys) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return {lookup(keys)...};
+    }
+
+    /**
+     * @brief Returns true when the key exists.
+     *
+     * @param key string with the key to look for.
+     */
+    bool contains(std::string_view key) const { return database_.find(key) != database_.end(); }
+
+    /**
+     * @brief Returns the amount of keys stored. It can be called from any thread.
+     */
+    size_t getSize() const { return size_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the amount of values written so far. It can be called from any thread.
+     */
+    uint64_t getWriteCount() const { return write_count_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the version of the values, bumped once by every call to set and by
+     *        every commit of a transaction. It can be called from any thread.
+     */
+    uint64_t getVersion() const { return version_.load(std::memory_order_acquire); }
+
    private:
-    std::map<std::string, Any> database_;
+    friend class BlackboardTransaction;
+
+    /** @brief Returns the entry of a key, created empty when it doesn't exist. */
+    Any& findOrCreate(std::string_view key) {
+        auto search = database_.find(key);
+        if (search == database_.end()) {
+            search = database_.emplace(std::string(key), Any()).first;
+            size_.store(database_.size(), std::memory_order_relaxed);
+        }
+        return search->second;
+    }
+
+    Any lookup(std::string_view key) const {
+        const Any* object = tryGet(key);
+        return (object == nullptr) ? Any() : *object;
+    }
+
+    // Transparent comparator, so keys can be looked up without building a std::string.
+    std::map<std::string, Any, std::less<>> database_;
+    // Held exclusively by writes, shared by getMany.
+    mutable std::shared_mutex mutex_;
+    std::atomic<size_t> size_{0};
+    std::atomic<uint64_t> write_count_{0};
+    std::atomic<uint64_t> version_{0};
 };
 
 }  // namespace behavior_tree
\ No newline at end of file
@@ -0,0 +1,143 @@
+/**
+ * @file BlackboardTransaction.hpp
+ * @brief Stages writes of several keys of a Blackboard and commits them in one step, so
+ *        getMany never sees some of them updated and others not.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Write batch of a Blackboard, meant to be kept by a node and reused every tick.
+ *        Keys are resolved by the first commit that writes them; as long as the node stages
+ *        the same keys in the same order, later commits don't look them up again, and
+ *        values of the same type are assigned in place, without allocating.
+ */
+class BlackboardTransaction {
+   public:
+    /**
+     * @brief Construct a new BlackboardTransaction object
+     *
+     * @param blackboard blackboard the writes are committed to, it must outlive the transaction.
+     */
+    explicit BlackboardTransaction(Blackboard& blackboard) : blackboard_{blackboard} {}
+
+    /**
+     * @brief Stages the write of a key. When the key is staged twice, the last value wins.
+     *
+     * @param key key string where the object should be stored
+     * @param object object to be stored, an Any or a plain value.
+     */
+    template <typename T>
+    void set(std::string_view key, const T& object) {
+        Staged& staged = stage(key);
+        if constexpr (std::is_same<T, Any>::value) {
+            staged.value = object;
+        } else {
+            staged.value.set(object);
+        }
+    }
+
+    /**
+     * @brief Writes the staged values, all of them with a single version bump.
+     *
+     * @return uint64_t version of the blackboard after the commit.
+     */
+    uint64_t commit() {
+        if (staged_count_ > 0) {
+            std::lock_guard<std::shared_mutex> lock(blackboard_.mutex_);
+            for (Staged& staged : staged_) {
+                if (!staged.active) {
+                    continue;
+                }
+                if (staged.entry == nullptr) {
+                    staged.entry = &blackboard_.findOrCreate(staged.key);
+                }
+                // The staged value takes the previous one, whose holder the next set can reuse.
+                staged.entry->swap(staged.value);
+            }
+            blackboard_.write_count_.fetch_add(staged_count_, std::memory_order_relaxed);
+            blackboard_.version_.fetch_add(1, std::memory_order_release);
+        }
+        finish();
+        return blackboard_.getVersion();
+    }
+
+    /**
+     * @brief Drops the staged values without writing them.
+     */
+    void discard() { finish(); }
+
+    /**
+     * @brief Returns the amount of keys staged since the last commit.
+     */
+    size_t getStagedCount() const { return staged_count_; }
+
+   private:
+    struct Staged {
+        std::string key;
+        // Entries of a blackboard are never erased, so they can be kept across commits.
+        Any* entry;
+        Any value;
+        bool active;
+    };
+
+    Staged& stage(std::string_view key) {
+        // The slot that followed the previous key last time is checked first.
+        size_t slot = next_;
+        if ((slot >= staged_.size()) || (staged_[slot].key != key)) {
+            slot = 0;
+            while ((slot < staged_.size()) && (staged_[slot].key != key)) {
+                ++slot;
+            }
+            if (slot == staged_.size()) {
+                staged_.push_back(Staged{std::string(key), nullptr, Any(), false});
+            }
+        }
+        Staged& staged = staged_[slot];
+        if (!staged.active) {
+            staged.active = true;
+            ++staged_count_;
+        }
+        next_ = slot + 1;
+        return staged;
+    }
+
+    void finish() {
+        for (Staged& staged : staged_) {
+            // Shared payloads are released now rather than when the key is staged again.
+            if (staged.value.isShared()) {
+                staged.value = Any();
+            }
+            staged.active = false;
+        }
+        staged_count_ = 0;
+        next_ = 0;
+    }
+
+    Blackboard& blackboard_;
+    std::vector<Staged> staged_;
+    size_t staged_count_ = 0;
+    size_t next_ = 0;
+};
+
+}  // namespace behavior_tree
@@ -0,0 +1,60 @@
+/**
+ * @file Clock.hpp
+ * @brief Monotonic clocks used by the nodes that depend on time.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <chrono>
+
+namespace behavior_tree {
+
+/**
+ * @brief Interface of a monotonic clock, so the time can be injected in tests.
+ */
+class Clock {
+   public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration = std::chrono::steady_clock::duration;
+
+    /** @brief Virtual destructor to ensure the proper destruction of derived clases */
+    virtual ~Clock() = default;
+
+    /**
+     * @brief Returns the current time.
+     */
+    virtual TimePoint now() const = 0;
+};
+
+/**
+ * @brief Clock backed by std::chrono::steady_clock.
+ */
+class SteadyClock : public Clock {
+   public:
+    TimePoint now() const override { return std::chrono::steady_clock::now(); }
+};
+
+/**
+ * @brief Clock that only moves when it is told to.
+ */
+class ManualClock : public Clock {
+   public:
+    TimePoint now() const override { return now_; }
+
+    /**
+     * @brief Moves the clock forward.
+     *
+     * @param duration time to move forward.
+     */
+    void advance(Duration duration) { now_ += duration; }
+
+   private:
+    TimePoint now_{};
+};
+
+}  // namespace behavior_tree
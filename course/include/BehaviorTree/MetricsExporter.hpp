@@ -0,0 +1,254 @@
+/**
+ * @file MetricsExporter.hpp
+ * @brief Serves the RuntimeStatistics in Prometheus text format over a local socket.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// System libraries
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/RuntimeStatistics.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Answers every connection with an HTTP response that holds the current
+ *        statistics in Prometheus text format. It listens either on a Unix domain
+ *        socket or on a TCP port bound to the loopback interface, and serves from
+ *        its own thread, so it never blocks the ticking thread.
+ */
+class MetricsExporter {
+   public:
+    /**
+     * @brief Construct a new MetricsExporter object
+     *
+     * @param statistics statistics to be served.
+     */
+    explicit MetricsExporter(std::shared_ptr<const RuntimeStatistics> statistics)
+        : statistics_{std::move(statistics)} {
+        if (statistics_ == nullptr) {
+            throw std::invalid_argument("statistics cannot be nullptr");
+        }
+    }
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    /**
+     * @brief Stops serving and releases the socket.
+     */
+    ~MetricsExporter() { stop(); }
+
+    /**
+     * @brief Starts serving on a Unix domain socket. An existing file in path is replaced.
+     *
+     * @param path path of the socket.
+     */
+    void listenUnix(const std::string& path) {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("Unix socket path too long");
+        }
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        ::unlink(path.c_str());
+        start(AF_UNIX, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        unix_path_ = path;
+    }
+
+    /**
+     * @brief Starts serving on a TCP port of the loopback interface.
+     *
+     * @param port port to listen on, 0 picks a free one.
+     * @return uint16_t port where it listens.
+     */
+    uint16_t listenTcp(uint16_t port) {
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        start(AF_INET, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+
+        socklen_t length = sizeof(address);
+        ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address), &length);
+        return ntohs(address.sin_port);
+    }
+
+    /**
+     * @brief Stops serving. It does nothing when it is not serving.
+     */
+    void stop() {
+        running_.store(false);
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        if (listen_fd_ != -1) {
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+        }
+        if (!unix_path_.empty()) {
+            ::unlink(unix_path_.c_str());
+            unix_path_.clear();
+        }
+    }
+
+    /**
+     * @brief Formats the statistics in Prometheus text format.
+     *
+     * @param snapshot statistics to be formatted.
+     * @return std::string formatted statistics.
+     */
+    static std::string formatPrometheus(const RuntimeStatistics::Snapshot& snapshot) {
+        std::ostringstream out;
+        out << "# HELP bt_ticks_total Ticks of the root node.\n"
+            << "# TYPE bt_ticks_total counter\n"
+            << "bt_ticks_total " << snapshot.total_ticks << "\n"
+            << "# HELP bt_ticks_per_second Ticks of the root node per second.\n"
+            << "# TYPE bt_ticks_per_second gauge\n"
+            << "bt_ticks_per_second " << snapshot.ticks_per_second << "\n"
+            << "# HELP bt_tick_latency_seconds Duration of the ticks of the root node.\n"
+            << "# TYPE bt_tick_latency_seconds summary\n"
+            << "bt_tick_latency_seconds{quantile=\"0.5\"} " << snapshot.latency_p50_ns * 1e-9 << "\n"
+            << "bt_tick_latency_seconds{quantile=\"0.9\"} " << snapshot.latency_p90_ns * 1e-9 << "\n"
+            << "bt_tick_latency_seconds{quantile=\"0.99\"} " << snapshot.latency_p99_ns * 1e-9 << "\n"
+            << "bt_tick_latency_seconds{quantile=\"1\"} " << snapshot.latency_max_ns * 1e-9 << "\n"
+            << "bt_tick_latency_seconds_sum " << snapshot.latency_sum_ns * 1e-9 << "\n"
+            << "bt_tick_latency_seconds_count " << snapshot.total_ticks << "\n"
+            << "# HELP bt_runs_total Calls to run by outcome.\n"
+            << "# TYPE bt_runs_total counter\n"
+            << "bt_runs_total{result=\"success\"} " << snapshot.runs_success << "\n"
+            << "bt_runs_total{result=\"failure\"} " << snapshot.runs_failure << "\n"
+            << "bt_runs_total{result=\"tick_limit\"} " << snapshot.runs_tick_limit << "\n"
+            << "# HELP bt_blackboard_entries Keys stored in the blackboard.\n"
+            << "# TYPE bt_blackboard_entries gauge\n"
+            << "bt_blackboard_entries " << snapshot.blackboard_size << "\n"
+            << "# HELP bt_blackboard_writes_total Writes to the blackboard.\n"
+            << "# TYPE bt_blackboard_writes_total counter\n"
+            << "bt_blackboard_writes_total " << snapshot.blackboard_writes << "\n"
+            << "# HELP bt_blackboard_writes_per_second Writes to the blackboard per second.\n"
+            << "# TYPE bt_blackboard_writes_per_second gauge\n"
+            << "bt_blackboard_writes_per_second " << snapshot.blackboard_writes_per_second << "\n"
+            << "# HELP bt_node_ticks_total Ticks per node.\n"
+            << "# TYPE bt_node_ticks_total counter\n";
+        for (const auto& node : snapshot.node_hits) {
+            out << "bt_node_ticks_total{node=\"" << escapeLabel(node.name) << "\"} " << node.ticks << "\n";
+        }
+        return out.str();
+    }
+
+   private:
+    static std::string escapeLabel(const std::string& value) {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (const char character : value) {
+            if (character == '\\' || character == '"') {
+                escaped += '\\';
+                escaped += character;
+            } else if (character == '\n') {
+                escaped += "\\n";
+            } else {
+                escaped += character;
+            }
+        }
+        return escaped;
+    }
+
+    void start(int domain, const sockaddr* address, socklen_t length) {
+        if (running_.load()) {
+            throw std::runtime_error("Metrics exporter already running");
+        }
+        listen_fd_ = ::socket(domain, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd_ == -1) {
+            throw std::runtime_error(std::string("Cannot create socket: ") + std::strerror(errno));
+        }
+        const int reuse = 1;
+        ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if ((::bind(listen_fd_, address, length) == -1) || (::listen(listen_fd_, 8) == -1)) {
+            const std::string error = std::strerror(errno);
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+            throw std::runtime_error("Cannot listen on socket: " + error);
+        }
+        running_.store(true);
+        thread_ = std::thread([this]() { serve(); });
+    }
+
+    void serve() {
+        while (running_.load()) {
+            pollfd listen_poll{listen_fd_, POLLIN, 0};
+            // Wakes up periodically to notice stop.
+            if (::poll(&listen_poll, 1, kPollTimeoutMs) <= 0) {
+                continue;
+            }
+            const int client_fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client_fd == -1) {
+                continue;
+            }
+            answer(client_fd);
+            ::close(client_fd);
+        }
+    }
+
+    void answer(int client_fd) {
+        // Read the request (whatever it is) so the client doesn't get a reset.
+        timeval timeout{0, kPollTimeoutMs * 1000};
+        ::setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        std::string request;
+        char buffer[1024];
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < kMaxRequestSize) {
+            const ssize_t bytes = ::recv(client_fd, buffer, sizeof(buffer), 0);
+            if (bytes <= 0) {
+                break;
+            }
+            request.append(buffer, static_cast<size_t>(bytes));
+        }
+
+        const std::string body = formatPrometheus(statistics_->snapshot());
+        std::string response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " +
+                               std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+        size_t sent = 0;
+        while (sent < response.size()) {
+            const ssize_t bytes = ::send(client_fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (bytes <= 0) {
+                break;
+            }
+            sent += static_cast<size_t>(bytes);
+        }
+    }
+
+    static constexpr int kPollTimeoutMs = 100;
+    static constexpr size_t kMaxRequestSize = 8192;
+
+    std::shared_ptr<const RuntimeStatistics> statistics_;
+    std::atomic<bool> running_{false};
+    int listen_fd_ = -1;
+    std::thread thread_;
+    std::string unix_path_;
+};
+
+}  // namespace behavior_tree
@@ -0,0 +1,108 @@
+/**
+ * @file NodeFactory.hpp
+ * @brief Builds nodes from their description.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/TreeDescription.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Registry of builders, one per kind of node. "Sequence", "Fallback" and
+ *        "Negation" are registered by default.
+ */
+class NodeFactory {
+   public:
+    /** @brief Builds a node from its description and its already built children. */
+    using Builder = std::function<std::shared_ptr<NodeInterface>(const NodeDescription& description,
+                                                                 std::vector<std::shared_ptr<NodeInterface>> children)>;
+
+    /**
+     * @brief Construct a new NodeFactory object with the built-in nodes.
+     */
+    NodeFactory() {
+        registerBuilder("Sequence", [](const NodeDescription& description,
+                                       std::vector<std::shared_ptr<NodeInterface>> children) {
+            return std::make_shared<SequenceNode>(description.name, std::move(children));
+        });
+        registerBuilder("Fallback", [](const NodeDescription& description,
+                                       std::vector<std::shared_ptr<NodeInterface>> children) {
+            return std::make_shared<FallbackNode>(description.name, std::move(children));
+        });
+        registerBuilder("Negation", [](const NodeDescription& description,
+                                       std::vector<std::shared_ptr<NodeInterface>> children) {
+            if (children.size() != 1) {
+                throw std::invalid_argument("Negation needs exactly one child");
+            }
+            return std::make_shared<NegationNode>(description.name, children.front());
+        });
+    }
+
+    /**
+     * @brief Registers (or replaces) the builder of a kind of node.
+     *
+     * @param kind kind of node.
+     * @param builder builder of the nodes of that kind.
+     */
+    void registerBuilder(const std::string& kind, Builder builder) { builders_[kind] = std::move(builder); }
+
+    /**
+     * @brief Builds a single node.
+     *
+     * @param description description of the node.
+     * @param children children of the node, already built.
+     * @return std::shared_ptr<NodeInterface> node built.
+     */
+    std::shared_ptr<NodeInterface> build(const NodeDescription& description,
+                                         std::vector<std::shared_ptr<NodeInterface>> children) const {
+        const auto builder = builders_.find(description.kind);
+        if (builder == builders_.end()) {
+            throw std::invalid_argument("Unknown node kind: " + description.kind);
+        }
+        auto node = builder->second(description, std::move(children));
+        if ((node == nullptr) || (node->getNameRef() != description.name)) {
+            throw std::runtime_error("Builder of " + description.kind + " returned an invalid node");
+        }
+        return node;
+    }
+
+    /**
+     * @brief Builds a whole tree, children first.
+     *
+     * @param description description of the root of the tree.
+     * @return std::shared_ptr<NodeInterface> root of the tree.
+     */
+    std::shared_ptr<NodeInterface> buildTree(const NodeDescription& description) const {
+        std::vector<std::shared_ptr<NodeInterface>> children;
+        children.reserve(description.children.size());
+        for (const auto& child : description.children) {
+            children.emplace_back(buildTree(child));
+        }
+        return build(description, std::move(children));
+    }
+
+   private:
+    std::map<std::string, Builder> builders_;
+};
+
+}  // namespace behavior_tree
@@ -12,9 +12,12 @@
 
 // Standard libraries
 #include <cstdint>
+#include <functional>
+#include <string>
 
 // Challenge includes
 #include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TickObserver.hpp"
 
 namespace behavior_tree {
 class NodeInterface {
@@ -23,7 +26,13 @@ class NodeInterface {
      *  @param[in] name name of the node.
      *  @param[in] key  order of the nodes to be executed.
      */
-    explicit NodeInterface(const std::string& name) : name_{name} {};
+    explicit NodeInterface(const std::string& name) : name_{name}, id_{kInvalidId}, observer_{nullptr} {};
+
+    /** @brief Id of the nodes that are not owned by a BTManager. */
+    static constexpr uint32_t kInvalidId = UINT32_MAX;
+
+    /** @brief Called with a node, e.g. with every child of a node. */
+    using Visitor = std::function<void(NodeInterface& node)>;
 
     /** @brief Virtual destructor to ensure the proper destruction of derived clases */
     virtual ~NodeInterface() = default;
@@ -35,6 +44,70 @@ class NodeInterface {
      */
     virtual NodeResult tick() = 0;
 
+    /**
+     * @brief Selects how the node advances through its children within a tick.
+     *        Only composite nodes react to it, the rest of the nodes ignore it.
+     *
+     * @param mode new tick mode of the node.
+     */
+    virtual void setTickMode(TickMode mode) { (void)mode; }
+
+    /**
+     * @brief Releases the resources that the node can rebuild on demand, if it has been
+     *        idle for long enough. Only lazy nodes react to it.
+     *
+     * @returns true when something was released.
+     */
+    virtual bool releaseIdle() { return false; }
+
+    /**
+     * @brief Tells the node that its parent stopped ticking it while it was RUNNING (e.g. a
+     *        TimeoutNode that gave up on it), so it drops what it was waiting for. By default
+     *        it halts the children of the node.
+     */
+    virtual void halt() {
+        visitChildren([](NodeInterface& child) { child.halt(); });
+    }
+
+    /**
+     * @brief Calls visitor with every child of the node, in order. Only nodes with children
+     *        react to it.
+     *
+     * @param visitor called with every child.
+     */
+    virtual void visitChildren(const Visitor& visitor) { (void)visitor; }
+
+    /**
+     * @brief Sets the hook of the BTManager that owns the node, which registers the nodes the
+     *        node builds by itself later on. Only lazy nodes react to it.
+     *
+     * @param registrar registers a node with the manager.
+     */
+    virtual void setRegistrar(Visitor registrar) { (void)registrar; }
+
+    /**
+     * @brief Ticks the node, notifying the observer (if any) before and after.
+     *        Parents must tick their children through this method so they can be observed.
+     *
+     * @returns the result of tick.
+     */
+    NodeResult observedTick() {
+        if (observer_ == nullptr) {
+            return tick();
+        }
+        observer_->beforeTick(*this);
+        const NodeResult result = tick();
+        observer_->afterTick(*this, result);
+        return result;
+    }
+
+    /**
+     * @brief Sets the observer notified on every tick. nullptr disables the notifications.
+     *
+     * @param observer observer to be notified, it must outlive the node.
+     */
+    void setTickObserver(TickObserver* observer) { observer_ = observer; }
+
     /**
      * @brief returns the name of the current node.
      *
@@ -42,7 +115,30 @@ class NodeInterface {
      */
     std::string getName() { return name_; }
 
+    /**
+     * @brief returns a reference to the name of the current node.
+     *
+     * @returns String with the name of the node.
+     */
+    const std::string& getNameRef() const { return name_; }
+
+    /**
+     * @brief returns the id given by the BTManager that owns the node.
+     *
+     * @returns id of the node, kInvalidId when it is not owned by a BTManager.
+     */
+    uint32_t getId() const { return id_; }
+
+    /**
+     * @brief sets the id of the node. Called by the BTManager that owns the node.
+     *
+     * @param id new id of the node.
+     */
+    void setId(uint32_t id) { id_ = id; }
+
    private:
     std::string name_;
+    uint32_t id_;
+    TickObserver* observer_;
 };
 }  // namespace behavior_tree
@@ -0,0 +1,202 @@
+/**
+ * @file NodeProfiler.hpp
+ * @brief Aggregates wall-clock time and hardware counters per node.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/PerfCounters.hpp"
+#include "BehaviorTree/TickObserver.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Tick observer that measures every tick of the observed nodes.
+ *        - Inclusive values cover the whole tick of the node, children included.
+ *        - Exclusive values subtract the ticks of the observed children.
+ *        When the hardware counters cannot be opened (e.g. inside containers) only
+ *        the wall-clock time is measured.
+ */
+class NodeProfiler : public TickObserver {
+   public:
+    /** @brief Values aggregated for one node. */
+    struct NodeProfile {
+        std::string name;
+        uint64_t calls = 0;
+        uint64_t inclusive_ns = 0;
+        uint64_t exclusive_ns = 0;
+        PerfCounters::Sample inclusive_counters{};
+        PerfCounters::Sample exclusive_counters{};
+    };
+
+    /**
+     * @brief Returns true when the hardware counters are being read.
+     */
+    bool countersAvailable() const { return counters_.available(); }
+
+    /**
+     * @brief Returns true when the given hardware counter is being read.
+     *
+     * @param counter counter to check.
+     */
+    bool countersAvailable(PerfCounters::Counter counter) const { return counters_.available(counter); }
+
+    /**
+     * @brief Returns the values aggregated for every observed node, indexed by node id.
+     */
+    const std::vector<NodeProfile>& getProfiles() const { return profiles_; }
+
+    /**
+     * @brief Discards every value aggregated so far.
+     */
+    void reset() {
+        for (auto& profile : profiles_) {
+            profile = NodeProfile{profile.name};
+        }
+    }
+
+    /**
+     * @brief Prints the nodes ranked by exclusive cycles, or by exclusive time when the
+     *        cycles counter is not available.
+     *
+     * @param out stream where the report is printed.
+     */
+    void printReport(std::ostream& out) const {
+        const bool by_cycles = counters_.available(PerfCounters::CYCLES);
+        std::vector<const NodeProfile*> ranking;
+        for (const auto& profile : profiles_) {
+            if (profile.calls != 0) {
+                ranking.emplace_back(&profile);
+            }
+        }
+        std::sort(ranking.begin(), ranking.end(), [by_cycles](const NodeProfile* lhs, const NodeProfile* rhs) {
+            if (by_cycles) {
+                return lhs->exclusive_counters[PerfCounters::CYCLES] > rhs->exclusive_counters[PerfCounters::CYCLES];
+            }
+            return lhs->exclusive_ns > rhs->exclusive_ns;
+        });
+
+        out << "Node profile, ranked by exclusive " << (by_cycles ? "cycles" : "time");
+        if (!counters_.available()) {
+            out << " (hardware counters not available, timing only)";
+        }
+        out << std::endl;
+        out << std::left << std::setw(24) << "node" << std::right << std::setw(10) << "calls" << std::setw(14)
+            << "excl_us" << std::setw(14) << "incl_us";
+        if (counters_.available()) {
+            out << std::setw(14) << "cycles" << std::setw(14) << "instructions" << std::setw(8) << "ipc"
+                << std::setw(14) << "cache_miss" << std::setw(14) << "branch_miss";
+        }
+        out << std::endl;
+        for (const NodeProfile* profile : ranking) {
+            const auto& counters = profile->exclusive_counters;
+            out << std::left << std::setw(24) << profile->name << std::right << std::setw(10) << profile->calls
+                << std::setw(14) << std::fixed << std::setprecision(3) << profile->exclusive_ns / 1000.0
+                << std::setw(14) << profile->inclusive_ns / 1000.0;
+            if (counters_.available()) {
+                const double ipc = counters[PerfCounters::CYCLES] == 0
+                                       ? 0.0
+                                       : static_cast<double>(counters[PerfCounters::INSTRUCTIONS]) /
+                                             static_cast<double>(counters[PerfCounters::CYCLES]);
+                out << std::setw(14) << counters[PerfCounters::CYCLES] << std::setw(14)
+                    << counters[PerfCounters::INSTRUCTIONS] << std::setw(8) << std::setprecision(2) << ipc
+                    << std::setw(14) << counters[PerfCounters::CACHE_MISSES] << std::setw(14)
+                    << counters[PerfCounters::BRANCH_MISSES];
+            }
+            out << std::endl;
+        }
+    }
+
+    void nodeAdded(NodeInterface& node) override {
+        if (node.getId() >= profiles_.size()) {
+            profiles_.resize(node.getId() + 1);
+        }
+        profiles_[node.getId()].name = node.getNameRef();
+    }
+
+    void beforeTick(NodeInterface& node) override {
+        // A node that threw left the frames of its ancestors behind, drop them when the root ticks again.
+        if (stack_.empty() || (&node == root_)) {
+            root_ = &node;
+            stack_.clear();
+        }
+        stack_.emplace_back();
+        Frame& frame = stack_.back();
+        frame.id = node.getId();
+        // Read the clock and the counters last, so the bookkeeping is not measured.
+        counters_.read(frame.start_counters);
+        frame.start = std::chrono::steady_clock::now();
+    }
+
+    void afterTick(NodeInterface& node, NodeResult result) override {
+        (void)node;
+        (void)result;
+        const auto end = std::chrono::steady_clock::now();
+        if (stack_.empty()) {
+            return;
+        }
+        PerfCounters::Sample end_counters;
+        counters_.read(end_counters);
+
+        const Frame frame = stack_.back();
+        stack_.pop_back();
+        const uint64_t elapsed_ns =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - frame.start).count());
+        PerfCounters::Sample delta;
+        for (size_t counter = 0; counter < PerfCounters::COUNTER_COUNT; ++counter) {
+            delta[counter] = end_counters[counter] - frame.start_counters[counter];
+        }
+
+        NodeProfile& profile = profiles_[frame.id];
+        ++profile.calls;
+        profile.inclusive_ns += elapsed_ns;
+        profile.exclusive_ns += elapsed_ns - std::min(elapsed_ns, frame.children_ns);
+        for (size_t counter = 0; counter < PerfCounters::COUNTER_COUNT; ++counter) {
+            profile.inclusive_counters[counter] += delta[counter];
+            profile.exclusive_counters[counter] +=
+                delta[counter] - std::min(delta[counter], frame.children_counters[counter]);
+        }
+
+        // The whole tick of this node belongs to the children of its parent.
+        if (!stack_.empty()) {
+            Frame& parent = stack_.back();
+            parent.children_ns += elapsed_ns;
+            for (size_t counter = 0; counter < PerfCounters::COUNTER_COUNT; ++counter) {
+                parent.children_counters[counter] += delta[counter];
+            }
+        }
+    }
+
+   private:
+    /** @brief Measurements of a tick in progress. */
+    struct Frame {
+        uint32_t id = NodeInterface::kInvalidId;
+        std::chrono::steady_clock::time_point start;
+        PerfCounters::Sample start_counters{};
+        uint64_t children_ns = 0;
+        PerfCounters::Sample children_counters{};
+    };
+
+    PerfCounters counters_;
+    std::vector<NodeProfile> profiles_;
+    std::vector<Frame> stack_;
+    const NodeInterface* root_ = nullptr;
+};
+
+}  // namespace behavior_tree
@@ -11,6 +11,31 @@
 
 #pragma once
 
+// Standard libraries
+#include <cstdlib>
+
+/**
+ * @brief Throws the exception, or aborts when the code is built without exceptions
+ *        (-fno-exceptions). Only the code of the non-throwing paths can be built that way.
+ */
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define BEHAVIOR_TREE_THROW(exception) throw exception
+#else
+#define BEHAVIOR_TREE_THROW(exception) std::abort()
+#endif
+
+/**
+ * @brief Defined when the code is built with ThreadSanitizer (-fsanitize=thread), which
+ *        doesn't model std::atomic_thread_fence.
+ */
+#if defined(__SANITIZE_THREAD__)
+#define BEHAVIOR_TREE_THREAD_SANITIZER
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define BEHAVIOR_TREE_THREAD_SANITIZER
+#endif
+#endif
+
 namespace behavior_tree {
 
 /**
@@ -18,4 +43,36 @@ namespace behavior_tree {
  */
 enum class NodeResult { SUCCESS, RUNNING, FAILURE };
 
+/**
+ * @brief How a composite node advances through its children within a single tick.
+ *          - STEP: ticks one child per tick and returns RUNNING while children remain.
+ *          - EAGER: keeps ticking the following children in the same tick until one of them
+ *            returns RUNNING or the outcome of the composite is decided.
+ */
+enum class TickMode { STEP, EAGER };
+
+/**
+ * @brief Identifier of a type that doesn't need RTTI. Every type gets the address of its
+ *        own inline variable, which is unique across the whole program.
+ */
+using TypeId = const void*;
+
+namespace internal {
+template <typename T>
+struct TypeIdTag {
+    static constexpr char tag = 0;
+};
+}  // namespace internal
+
+/**
+ * @brief Returns the identifier of a type.
+ *
+ * @tparam T type to be identified.
+ * @return TypeId identifier of the type.
+ */
+template <typename T>
+constexpr TypeId typeId() {
+    return &internal::TypeIdTag<T>::tag;
+}
+
 }  // namespace behavior_tree
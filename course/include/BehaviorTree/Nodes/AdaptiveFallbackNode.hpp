@@ -0,0 +1,306 @@
+/**
+ * @file AdaptiveFallbackNode.hpp
+ * @brief Behavior of the node:
+ *          - It behaves as FallbackNode, but it tries its children in the order that
+ *            minimizes the expected cost of reaching a decision.
+ *          - For every child it tracks the success rate and the average cost of an attempt
+ *            (exponential moving averages). The cost of an attempt is the amount of ticks the
+ *            child needed to return SUCCESS or FAILURE, or the time spent ticking it.
+ *          - After every decision the unpinned children are sorted by cost / success rate,
+ *            which is the optimal order for independent alternatives. Pinned children keep
+ *            their position.
+ *          - Every decision starts from the first child of the current order.
+ *          - An unpinned child that hasn't been tried for exploration_period decisions is moved
+ *            to the first unpinned position for the next decision, so a child that failed
+ *            early gets another chance instead of being ruled out for good.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Clock.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Settings of an AdaptiveFallbackNode.
+ */
+struct AdaptiveFallbackOptions {
+    /** @brief Indexes of the children that keep their position. */
+    std::vector<size_t> pinned;
+    /** @brief Weight of the newest attempt in the averages, in (0, 1]. */
+    double smoothing = 0.1;
+    /**
+     * @brief Decisions without trying a child after which it is tried first once. 0 never
+     *        explores, then the order only follows the statistics.
+     */
+    uint32_t exploration_period = 100;
+    /** @brief Measures the cost in time instead of in ticks. */
+    bool measure_time = false;
+    /** @brief Clock used when measure_time is set. */
+    std::shared_ptr<const Clock> clock = std::make_shared<SteadyClock>();
+};
+
+/**
+ * @brief What the node learnt about one of its children.
+ */
+struct AdaptiveFallbackChildStatistics {
+    uint64_t attempts;
+    uint64_t successes;
+    /** @brief Moving average of the success rate. */
+    double success_rate;
+    /** @brief Moving average of the cost of an attempt, in ticks or nanoseconds. */
+    double cost;
+    /** @brief Position of the child in the current order. */
+    size_t position;
+    bool pinned;
+    /** @brief Decision in which the child was last tried, counting from 1; 0 when it never was. */
+    uint64_t last_decision;
+};
+
+class AdaptiveFallbackNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new AdaptiveFallbackNode object
+     *
+     * @param name name of the node.
+     * @param children alternatives, the initial order.
+     * @param options pinned children and how the cost is measured.
+     * @param tick_mode tick mode of the node.
+     */
+    AdaptiveFallbackNode(const std::string& name, std::vector<std::shared_ptr<NodeInterface>> children,
+                         AdaptiveFallbackOptions options = {}, TickMode tick_mode = TickMode::STEP)
+        : NodeInterface(name),
+          children_{std::move(children)},
+          smoothing_{options.smoothing},
+          exploration_period_{options.exploration_period},
+          measure_time_{options.measure_time},
+          clock_{options.clock},
+          tick_mode_{tick_mode} {
+        for (const auto& child : children_) {
+            if (child == nullptr) {
+                throw std::invalid_argument("child cannot be nullptr");
+            }
+        }
+        if (!(smoothing_ > 0.0) || (smoothing_ > 1.0)) {
+            throw std::invalid_argument("smoothing must be in (0, 1]");
+        }
+        if (measure_time_ && (clock_ == nullptr)) {
+            throw std::invalid_argument("Clock cannot be nullptr");
+        }
+        statistics_.resize(children_.size());
+        order_.resize(children_.size());
+        for (size_t child = 0; child < children_.size(); ++child) {
+            // Neutral priors: a coin flip that costs one tick.
+            statistics_[child] =
+                AdaptiveFallbackChildStatistics{0, 0, 0.5, measure_time_ ? 0.0 : 1.0, child, false, 0};
+            order_[child] = child;
+        }
+        for (const size_t child : options.pinned) {
+            if (child >= children_.size()) {
+                throw std::invalid_argument("pinned child out of range");
+            }
+            statistics_[child].pinned = true;
+        }
+    };
+
+    /**
+     * @brief this method implements the functionality of the adaptive fallback node.
+     *
+     * @returns RUNNING if the node didn't finish, SUCESS or FAILURE otherwise.
+     */
+    NodeResult tick() override {
+        if (children_.empty()) {
+            return NodeResult::SUCCESS;
+        }
+        do {
+            const size_t child = order_[position_];
+            const NodeResult result = tickChild(child);
+            if (result == NodeResult::RUNNING) {
+                return result;
+            }
+            record(child, result == NodeResult::SUCCESS);
+            if (result == NodeResult::SUCCESS) {
+                decide();
+                return result;
+            }
+            ++position_;
+            if (position_ == children_.size()) {
+                decide();
+                return NodeResult::FAILURE;
+            }
+            // In EAGER mode the next child is ticked right away.
+        } while (tick_mode_ == TickMode::EAGER);
+        return NodeResult::RUNNING;
+    }
+
+    /**
+     * @brief Selects how the node advances through its children within a tick.
+     *
+     * @param mode new tick mode of the node.
+     */
+    void setTickMode(TickMode mode) override { tick_mode_ = mode; }
+
+    /**
+     * @brief Halts the children. The next tick starts a new decision from the first child of
+     *        the current order; the interrupted attempt isn't recorded.
+     */
+    void halt() override {
+        position_ = 0;
+        attempt_cost_ = 0.0;
+        NodeInterface::halt();
+    }
+
+    /**
+     * @brief Returns the indexes of the children in the order they are tried.
+     */
+    const std::vector<size_t>& getOrder() const { return order_; }
+
+    /**
+     * @brief Returns what the node learnt about a child.
+     *
+     * @param child index of the child, as given to the constructor.
+     */
+    const AdaptiveFallbackChildStatistics& getChildStatistics(size_t child) const { return statistics_.at(child); }
+
+    /**
+     * @brief Returns the amount of decisions after which the order changed.
+     */
+    uint64_t getReorderCount() const { return reorder_count_; }
+
+    /**
+     * @brief Calls visitor with every child of the node, in order.
+     *
+     * @param visitor called with every child.
+     */
+    void visitChildren(const Visitor& visitor) override {
+        for (auto& child : children_) {
+            visitor(*child);
+        }
+    }
+
+   private:
+    NodeResult tickChild(size_t child) {
+        if (!measure_time_) {
+            attempt_cost_ += 1.0;
+            return children_[child]->observedTick();
+        }
+        const auto start = clock_->now();
+        const NodeResult result = children_[child]->observedTick();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_->now() - start);
+        attempt_cost_ += static_cast<double>(elapsed.count());
+        return result;
+    }
+
+    void record(size_t child, bool success) {
+        AdaptiveFallbackChildStatistics& statistics = statistics_[child];
+        ++statistics.attempts;
+        statistics.successes += success ? 1 : 0;
+        statistics.last_decision = decision_count_ + 1;
+        // The first attempt replaces the prior of the cost, which has no natural value for time.
+        const double weight = (statistics.attempts == 1) ? 1.0 : smoothing_;
+        statistics.success_rate += smoothing_ * ((success ? 1.0 : 0.0) - statistics.success_rate);
+        statistics.cost += weight * (attempt_cost_ - statistics.cost);
+        attempt_cost_ = 0.0;
+    }
+
+    /** @brief Ends a decision: the next one starts over with the best order, or explores. */
+    void decide() {
+        position_ = 0;
+        ++decision_count_;
+        // Insertion sort of the unpinned positions: few children, almost sorted, no allocations.
+        bool changed = false;
+        for (size_t position = 1; position < order_.size(); ++position) {
+            if (statistics_[order_[position]].pinned) {
+                continue;
+            }
+            size_t current = position;
+            for (size_t previous = position; previous-- > 0;) {
+                if (statistics_[order_[previous]].pinned) {
+                    continue;
+                }
+                if (priority(order_[previous]) <= priority(order_[current])) {
+                    break;
+                }
+                std::swap(order_[previous], order_[current]);
+                current = previous;
+                changed = true;
+            }
+        }
+        changed = explore() || changed;
+        if (changed) {
+            ++reorder_count_;
+            for (size_t position = 0; position < order_.size(); ++position) {
+                statistics_[order_[position]].position = position;
+            }
+        }
+    }
+
+    /** @brief Moves the stalest unpinned child to the first unpinned position, if it is stale enough. */
+    bool explore() {
+        if (exploration_period_ == 0) {
+            return false;
+        }
+        size_t first = order_.size();
+        size_t stalest = order_.size();
+        for (size_t position = 0; position < order_.size(); ++position) {
+            const AdaptiveFallbackChildStatistics& statistics = statistics_[order_[position]];
+            if (statistics.pinned) {
+                continue;
+            }
+            if (first == order_.size()) {
+                first = position;
+            }
+            if ((stalest == order_.size()) || (statistics.last_decision < statistics_[order_[stalest]].last_decision)) {
+                stalest = position;
+            }
+        }
+        if ((stalest == first) ||
+            (decision_count_ - statistics_[order_[stalest]].last_decision < exploration_period_)) {
+            return false;
+        }
+        // The next decide sorts it back into place unless it did well.
+        std::swap(order_[first], order_[stalest]);
+        return true;
+    }
+
+    /** @brief Expected cost of a success through the child, the lower the earlier it is tried. */
+    double priority(size_t child) const {
+        const AdaptiveFallbackChildStatistics& statistics = statistics_[child];
+        if (statistics.success_rate <= 0.0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return statistics.cost / statistics.success_rate;
+    }
+
+    std::vector<std::shared_ptr<NodeInterface>> children_;
+    double smoothing_;
+    uint32_t exploration_period_;
+    bool measure_time_;
+    std::shared_ptr<const Clock> clock_;
+    TickMode tick_mode_;
+    std::vector<AdaptiveFallbackChildStatistics> statistics_;
+    std::vector<size_t> order_;
+    size_t position_ = 0;
+    double attempt_cost_ = 0.0;
+    uint64_t reorder_count_ = 0;
+    uint64_t decision_count_ = 0;
+};
+}  // namespace behavior_tree
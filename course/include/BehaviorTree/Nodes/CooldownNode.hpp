@@ -0,0 +1,83 @@
+/**
+ * @file CooldownNode.hpp
+ * @brief Behavior of the node:
+ *          - With every call to tick, it will tick its child and return its result.
+ *          - When the child returns SUCCESS, the child is not ticked again until the
+ *            cooldown has elapsed. Meanwhile, it returns FAILURE.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+// Challenge includes
+#include "BehaviorTree/Clock.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+class CooldownNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new CooldownNode object
+     *
+     * @param name name of the node.
+     * @param child child to be suppressed after it succeeds.
+     * @param cooldown time during which the child is suppressed.
+     * @param clock clock used to measure the cooldown.
+     */
+    CooldownNode(const std::string& name, std::shared_ptr<NodeInterface> child, Clock::Duration cooldown,
+                 std::shared_ptr<const Clock> clock = std::make_shared<SteadyClock>())
+        : NodeInterface(name), child_{child}, clock_{clock}, cooldown_{cooldown} {
+        if (child_ == nullptr) {
+            throw std::invalid_argument("Child cannot be nullptr");
+        }
+        if (clock_ == nullptr) {
+            throw std::invalid_argument("Clock cannot be nullptr");
+        }
+    };
+
+    /**
+     * @brief this method implements the functionality of the cooldown node.
+     *
+     * @returns FAILURE during the cooldown, the result of the child otherwise.
+     */
+    NodeResult tick() override {
+        if (cooling_down_) {
+            if (clock_->now() < cooldown_end_) {
+                return NodeResult::FAILURE;
+            }
+            cooling_down_ = false;
+        }
+        const NodeResult result = child_->observedTick();
+        if (result == NodeResult::SUCCESS) {
+            cooling_down_ = true;
+            cooldown_end_ = clock_->now() + cooldown_;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Calls visitor with the child of the node.
+     *
+     * @param visitor called with the child.
+     */
+    void visitChildren(const Visitor& visitor) override { visitor(*child_); }
+
+   private:
+    std::shared_ptr<NodeInterface> child_;
+    std::shared_ptr<const Clock> clock_;
+    Clock::Duration cooldown_;
+    bool cooling_down_ = false;
+    Clock::TimePoint cooldown_end_{};
+};
+}  // namespace behavior_tree
@@ -25,16 +25,19 @@ namespace behavior_tree {
  * @brief Behavior of the node:
  *          - Until it finishes its execution, it will return RUNNING.
  *          - With every call to tick, it will tick one of its children in order.
- *          - When a child returns SUCCESS it will stop and return sucess.
+ *          - When a child returns SUCCESS it will stop and return sucess. The next
+ *            tick starts over from the first child.
  *          - When a child returns FAILURE it will tick the next child.
  *          - When the last child returns FAILURE too it will return FAILURE.
  *          - When the child returns RUNNING it will tick it again.
+ *          - In EAGER mode, a child returning FAILURE makes it tick the next child in the same tick.
  *
  */
 class FallbackNode : public NodeInterface {
    public:
-    FallbackNode(const std::string& name, std::vector<std::shared_ptr<NodeInterface>> children)
-        : NodeInterface(name), children_{children} {
+    FallbackNode(const std::string& name, std::vector<std::shared_ptr<NodeInterface>> children,
+                 TickMode tick_mode = TickMode::STEP)
+        : NodeInterface(name), children_{children}, tick_mode_{tick_mode} {
         for (auto child : children_) {
             if (child == nullptr) {
                 throw std::invalid_argument("child cannot be nullptr");
@@ -49,22 +52,58 @@ class FallbackNode : public NodeInterface {
      */
     NodeResult tick() override {
         if (children_.size() != 0) {
-            const auto result = children_[children_count_index_]->tick();
+            do {
+                const auto result = children_[children_count_index_]->observedTick();
 
-            if ((result == NodeResult::RUNNING) || (result == NodeResult::SUCCESS)) {
-                return result;
-            }
-            ++children_count_index_;
-            if (children_count_index_ != children_.size()) {
-                return NodeResult::RUNNING;
-            }
-            return NodeResult::FAILURE;
+                if (result == NodeResult::RUNNING) {
+                    return result;
+                }
+                // Once decided, the next activation starts over from the first child.
+                if (result == NodeResult::SUCCESS) {
+                    children_count_index_ = 0;
+                    return result;
+                }
+                ++children_count_index_;
+                if (children_count_index_ == children_.size()) {
+                    children_count_index_ = 0;
+                    return NodeResult::FAILURE;
+                }
+                // In EAGER mode the next child is ticked right away.
+            } while (tick_mode_ == TickMode::EAGER);
+            return NodeResult::RUNNING;
         }
         return NodeResult::SUCCESS;
     }
 
+    /**
+     * @brief Selects how the node advances through its children within a tick.
+     *
+     * @param mode new tick mode of the node.
+     */
+    void setTickMode(TickMode mode) override { tick_mode_ = mode; }
+
+    /**
+     * @brief Halts the children. The next tick starts over from the first child.
+     */
+    void halt() override {
+        children_count_index_ = 0;
+        NodeInterface::halt();
+    }
+
+    /**
+     * @brief Calls visitor with every child of the node, in order.
+     *
+     * @param visitor called with every child.
+     */
+    void visitChildren(const Visitor& visitor) override {
+        for (auto& child : children_) {
+            visitor(*child);
+        }
+    }
+
    private:
     std::vector<std::shared_ptr<NodeInterface>> children_;
     uint32_t children_count_index_;
+    TickMode tick_mode_;
 };
 }  // namespace behavior_tree
\ No newline at end of file
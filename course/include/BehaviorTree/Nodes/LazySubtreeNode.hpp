@@ -0,0 +1,171 @@
+/**
+ * @file LazySubtreeNode.hpp
+ * @brief Behavior of the node:
+ *          - It holds a factory of its subtree instead of the subtree itself.
+ *          - The first call to tick builds the subtree. Every call to tick ticks the
+ *            subtree and returns its result.
+ *          - releaseIdle destroys the subtree when it has not been ticked for the idle
+ *            period and it is not RUNNING. The next tick builds it again, from scratch.
+ *          - When it is owned by a BTManager, the nodes of the subtree are registered with
+ *            it as they are built, and a subtree built again gets the ids of the previous one.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <chrono>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Clock.hpp"
+#include "BehaviorTree/NodeFactory.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TreeDescription.hpp"
+
+namespace behavior_tree {
+
+class LazySubtreeNode : public NodeInterface {
+   public:
+    /** @brief Builds the subtree. */
+    using Factory = std::function<std::shared_ptr<NodeInterface>()>;
+
+    /**
+     * @brief Construct a new LazySubtreeNode object from a factory.
+     *
+     * @param name name of the node.
+     * @param factory builds the subtree.
+     * @param idle_period time without ticks before the subtree can be released, zero never releases it.
+     * @param clock clock used to measure the idle period.
+     */
+    LazySubtreeNode(const std::string& name, Factory factory, Clock::Duration idle_period = Clock::Duration::zero(),
+                    std::shared_ptr<const Clock> clock = std::make_shared<SteadyClock>())
+        : NodeInterface(name), factory_{std::move(factory)}, idle_period_{idle_period}, clock_{clock} {
+        if (!factory_) {
+            throw std::invalid_argument("factory cannot be empty");
+        }
+        if (clock_ == nullptr) {
+            throw std::invalid_argument("Clock cannot be nullptr");
+        }
+    };
+
+    /**
+     * @brief Construct a new LazySubtreeNode object from a description.
+     *
+     * @param name name of the node.
+     * @param description description of the subtree, shared with the catalogue.
+     * @param node_factory factory that builds the nodes of the description.
+     * @param idle_period time without ticks before the subtree can be released, zero never releases it.
+     * @param clock clock used to measure the idle period.
+     */
+    LazySubtreeNode(const std::string& name, std::shared_ptr<const NodeDescription> description,
+                    std::shared_ptr<const NodeFactory> node_factory,
+                    Clock::Duration idle_period = Clock::Duration::zero(),
+                    std::shared_ptr<const Clock> clock = std::make_shared<SteadyClock>())
+        : LazySubtreeNode(name, makeFactory(description, node_factory), idle_period, clock){};
+
+    /**
+     * @brief this method implements the functionality of the lazy subtree node.
+     *
+     * @returns the result of the subtree.
+     */
+    NodeResult tick() override {
+        if (child_ == nullptr) {
+            child_ = factory_();
+            if (child_ == nullptr) {
+                throw std::runtime_error("factory returned nullptr");
+            }
+            if (registrar_) {
+                size_t index = 0;
+                registerSubtree(*child_, index);
+            }
+        }
+        last_tick_ = clock_->now();
+        last_result_ = child_->observedTick();
+        return last_result_;
+    }
+
+    /**
+     * @brief Releases the subtree if it is idle.
+     *
+     * @returns true when the subtree was released.
+     */
+    bool releaseIdle() override {
+        if ((child_ == nullptr) || (idle_period_ == Clock::Duration::zero()) ||
+            (last_result_ == NodeResult::RUNNING) || (clock_->now() - last_tick_ < idle_period_)) {
+            return false;
+        }
+        child_.reset();
+        return true;
+    }
+
+    /**
+     * @brief Calls visitor with the root of the subtree, when it is built.
+     *
+     * @param visitor called with the root of the subtree.
+     */
+    void visitChildren(const Visitor& visitor) override {
+        if (child_ != nullptr) {
+            visitor(*child_);
+        }
+    }
+
+    /**
+     * @brief Sets the hook that registers the nodes of the subtree with the BTManager that owns it.
+     *
+     * @param registrar registers a node with the manager.
+     */
+    void setRegistrar(Visitor registrar) override { registrar_ = std::move(registrar); }
+
+    /**
+     * @brief Returns true when the subtree is built.
+     */
+    bool isMaterialized() const { return child_ != nullptr; }
+
+   private:
+    static Factory makeFactory(std::shared_ptr<const NodeDescription> description,
+                               std::shared_ptr<const NodeFactory> node_factory) {
+        if ((description == nullptr) || (node_factory == nullptr)) {
+            throw std::invalid_argument("description and factory cannot be nullptr");
+        }
+        return [description, node_factory]() { return node_factory->buildTree(*description); };
+    }
+
+    // Registers the nodes of the subtree depth first, in the same order every time it is built.
+    void registerSubtree(NodeInterface& node, size_t& index) {
+        // Nodes the manager owns already, e.g. shared with the rest of the tree, are left as they are.
+        if (node.getId() != NodeInterface::kInvalidId) {
+            return;
+        }
+        if (index < ids_.size()) {
+            node.setId(ids_[index]);
+        }
+        registrar_(node);
+        if (index == ids_.size()) {
+            ids_.push_back(node.getId());
+        }
+        ++index;
+        node.visitChildren([this, &index](NodeInterface& child) { registerSubtree(child, index); });
+    }
+
+    Factory factory_;
+    Clock::Duration idle_period_;
+    std::shared_ptr<const Clock> clock_;
+    std::shared_ptr<NodeInterface> child_;
+    Clock::TimePoint last_tick_{};
+    NodeResult last_result_ = NodeResult::SUCCESS;
+    Visitor registrar_;
+    // Ids given to the nodes of the subtree, by registration order.
+    std::vector<uint32_t> ids_;
+};
+}  // namespace behavior_tree
@@ -38,7 +38,7 @@ class NegationNode : public NodeInterface {
      * @returns RUNNING if the node didn't finish, SUCESS or FAILURE otherwise.
      */
     NodeResult tick() override {
-        const NodeResult result = child_->tick();
+        const NodeResult result = child_->observedTick();
         if (result == NodeResult::SUCCESS) {
             return NodeResult::FAILURE;
         } else if (result == NodeResult::FAILURE) {
@@ -47,6 +47,13 @@ class NegationNode : public NodeInterface {
         return result;
     }
 
+    /**
+     * @brief Calls visitor with the child of the node.
+     *
+     * @param visitor called with the child.
+     */
+    void visitChildren(const Visitor& visitor) override { visitor(*child_); }
+
    private:
     std::shared_ptr<NodeInterface> child_;
 };
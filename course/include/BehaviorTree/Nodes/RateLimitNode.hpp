@@ -0,0 +1,109 @@
+/**
+ * @file RateLimitNode.hpp
+ * @brief Behavior of the node:
+ *          - The first call to tick always ticks its child.
+ *          - Afterwards, it ticks its child at most once every period, measured either in
+ *            time or in ticks of this node.
+ *          - In between, it returns the last result of the child without ticking it.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+// Challenge includes
+#include "BehaviorTree/Clock.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+class RateLimitNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a node that ticks its child at most once every period of time.
+     *
+     * @param name name of the node.
+     * @param child child to be limited.
+     * @param period minimum time between two ticks of the child.
+     * @param clock clock used to measure the period.
+     */
+    RateLimitNode(const std::string& name, std::shared_ptr<NodeInterface> child, Clock::Duration period,
+                  std::shared_ptr<const Clock> clock = std::make_shared<SteadyClock>())
+        : NodeInterface(name), child_{child}, clock_{clock}, period_{period}, tick_period_{0} {
+        if (child_ == nullptr) {
+            throw std::invalid_argument("Child cannot be nullptr");
+        }
+        if (clock_ == nullptr) {
+            throw std::invalid_argument("Clock cannot be nullptr");
+        }
+    };
+
+    /**
+     * @brief Construct a node that ticks its child at most once every tick_period ticks.
+     *
+     * @param name name of the node.
+     * @param child child to be limited.
+     * @param tick_period ticks of this node between two ticks of the child.
+     */
+    RateLimitNode(const std::string& name, std::shared_ptr<NodeInterface> child, uint32_t tick_period)
+        : NodeInterface(name), child_{child}, period_{0}, tick_period_{tick_period} {
+        if (child_ == nullptr) {
+            throw std::invalid_argument("Child cannot be nullptr");
+        }
+        if (tick_period_ == 0) {
+            throw std::invalid_argument("Tick period cannot be 0");
+        }
+    };
+
+    /**
+     * @brief this method implements the functionality of the rate limit node.
+     *
+     * @returns the result of the child, or its last result when the child is not ticked.
+     */
+    NodeResult tick() override {
+        if (clock_ == nullptr) {
+            if (ticks_since_child_ != 0 && ticks_since_child_ < tick_period_) {
+                ++ticks_since_child_;
+                return last_result_;
+            }
+            ticks_since_child_ = 1;
+        } else {
+            const Clock::TimePoint now = clock_->now();
+            if (ticked_ && (now - last_child_tick_ < period_)) {
+                return last_result_;
+            }
+            last_child_tick_ = now;
+            ticked_ = true;
+        }
+        last_result_ = child_->observedTick();
+        return last_result_;
+    }
+
+    /**
+     * @brief Calls visitor with the child of the node.
+     *
+     * @param visitor called with the child.
+     */
+    void visitChildren(const Visitor& visitor) override { visitor(*child_); }
+
+   private:
+    std::shared_ptr<NodeInterface> child_;
+    std::shared_ptr<const Clock> clock_;
+    Clock::Duration period_;
+    uint32_t tick_period_;
+    uint32_t ticks_since_child_ = 0;
+    bool ticked_ = false;
+    Clock::TimePoint last_child_tick_{};
+    NodeResult last_result_ = NodeResult::RUNNING;
+};
+}  // namespace behavior_tree
@@ -0,0 +1,91 @@
+/**
+ * @file RemoteActionNode.hpp
+ * @brief Behavior of the node:
+ *          - The first call to tick submits a request to the RemoteActionClient and returns RUNNING.
+ *          - Every call to tick returns RUNNING until the response arrives, then it returns
+ *            the result of the response (SUCCESS or FAILURE) and keeps its output.
+ *          - The next call to tick submits a new request.
+ *          - halt cancels the pending request (e.g. when a TimeoutNode gives up on it), its
+ *            response is dropped when it arrives and the next tick submits a new one.
+ *          - It never blocks: the client sends and receives between ticks.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/RemoteAction.hpp"
+
+namespace behavior_tree {
+
+class RemoteActionNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new RemoteActionNode object
+     *
+     * @param name name of the node.
+     * @param client connection shared by the remote actions of the tree.
+     * @param action name of the action in the server.
+     * @param arguments arguments sent with every request.
+     */
+    RemoteActionNode(const std::string& name, std::shared_ptr<RemoteActionClient> client, const std::string& action,
+                     const std::string& arguments = "")
+        : NodeInterface(name), client_{client}, action_{action}, arguments_{arguments} {
+        if (client_ == nullptr) {
+            throw std::invalid_argument("client cannot be nullptr");
+        }
+    };
+
+    /**
+     * @brief this method implements the functionality of the remote action node.
+     *
+     * @returns RUNNING while the response is pending, its result otherwise.
+     */
+    NodeResult tick() override {
+        if (request_id_ == kNoRequest) {
+            request_id_ = client_->submit(action_, arguments_);
+        }
+        if (!client_->takeResponse(request_id_, response_)) {
+            return NodeResult::RUNNING;
+        }
+        request_id_ = kNoRequest;
+        return response_.result;
+    }
+
+    /**
+     * @brief Cancels the pending request, if any.
+     */
+    void halt() override {
+        if (request_id_ != kNoRequest) {
+            client_->cancel(request_id_);
+            request_id_ = kNoRequest;
+        }
+    }
+
+    /**
+     * @brief Returns the output of the last response.
+     */
+    const std::string& getOutput() const { return response_.output; }
+
+   private:
+    static constexpr uint32_t kNoRequest = 0;
+
+    std::shared_ptr<RemoteActionClient> client_;
+    std::string action_;
+    std::string arguments_;
+    uint32_t request_id_ = kNoRequest;
+    RemoteActionResponse response_{NodeResult::FAILURE, ""};
+};
+}  // namespace behavior_tree
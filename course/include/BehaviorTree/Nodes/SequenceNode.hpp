@@ -8,6 +8,7 @@
  *          - When the child returns FAILURE it will be restart the execution of all the nodes.
  *          - When the child returns RUNNING it will tick it again.
  *          - When all the children return SUCCESS, it will return SUCESS.
+ *          - In EAGER mode, a child returning SUCCESS makes it tick the next child in the same tick.
  *
  * @version 0.1
  * @date 2020-06-01
@@ -31,8 +32,9 @@ namespace behavior_tree {
 
 class SequenceNode : public NodeInterface {
    public:
-    explicit SequenceNode(const std::string& name, std::vector<std::shared_ptr<NodeInterface>> children)
-        : NodeInterface(name), children_{children} {
+    explicit SequenceNode(const std::string& name, std::vector<std::shared_ptr<NodeInterface>> children,
+                          TickMode tick_mode = TickMode::STEP)
+        : NodeInterface(name), children_{children}, tick_mode_{tick_mode} {
         for (auto child = children_.begin(); child != children_.end(); ++child) {
             if (*child == nullptr) {
                 throw std::invalid_argument("child cannot be nullptr");
@@ -47,21 +49,25 @@ class SequenceNode : public NodeInterface {
      */
     NodeResult tick() override {
         if (children_.size() != 0) {
-            const NodeResult result = children_[children_count_index_]->tick();
-            // When the child returns RUNNING it will tick it again.
-            if (result == NodeResult::RUNNING) {
-                return result;
-            }
-            // When the child returns FAILURE it will be restart the execution of all the nodes.
-            else if (result == NodeResult::FAILURE) {
-                children_count_index_ = 0;
-                return NodeResult::RUNNING;
-            }
-            ++children_count_index_;
-            // When all the children return SUCCESS, it will return SUCESS.
-            if (children_count_index_ == (children_.size())) {
-                return NodeResult::SUCCESS;
-            }
+            do {
+                const NodeResult result = children_[children_count_index_]->observedTick();
+                // When the child returns RUNNING it will tick it again.
+                if (result == NodeResult::RUNNING) {
+                    return result;
+                }
+                // When the child returns FAILURE it will be restart the execution of all the nodes.
+                else if (result == NodeResult::FAILURE) {
+                    children_count_index_ = 0;
+                    return NodeResult::RUNNING;
+                }
+                ++children_count_index_;
+                // When all the children return SUCCESS, it will return SUCESS.
+                if (children_count_index_ == (children_.size())) {
+                    children_count_index_ = 0;
+                    return NodeResult::SUCCESS;
+                }
+                // In EAGER mode the next child is ticked right away.
+            } while (tick_mode_ == TickMode::EAGER);
 
             // Point to the next child to be ticked.
             return NodeResult::RUNNING;
@@ -69,8 +75,35 @@ class SequenceNode : public NodeInterface {
         return NodeResult::SUCCESS;
     }
 
+    /**
+     * @brief Selects how the node advances through its children within a tick.
+     *
+     * @param mode new tick mode of the node.
+     */
+    void setTickMode(TickMode mode) override { tick_mode_ = mode; }
+
+    /**
+     * @brief Halts the children. The next tick starts over from the first child.
+     */
+    void halt() override {
+        children_count_index_ = 0;
+        NodeInterface::halt();
+    }
+
+    /**
+     * @brief Calls visitor with every child of the node, in order.
+     *
+     * @param visitor called with every child.
+     */
+    void visitChildren(const Visitor& visitor) override {
+        for (auto& child : children_) {
+            visitor(*child);
+        }
+    }
+
    private:
     std::vector<std::shared_ptr<NodeInterface>> children_;
     uint32_t children_count_index_;
+    TickMode tick_mode_;
 };
 }  // namespace behavior_tree
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**
+ * @file SubtreeInstanceNode.hpp
+ * @brief Behavior of the node:
+ *          - It ticks a SharedSubtree and returns its result.
+ *          - The structure is shared with the rest of the instances, the node only owns the
+ *            state of the subtree: one word per sequence and fallback.
+ *          - The tick mode of the node applies to every sequence and fallback of the subtree.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/SharedSubtree.hpp"
+
+namespace behavior_tree {
+
+class SubtreeInstanceNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new SubtreeInstanceNode object
+     *
+     * @param name name of the node.
+     * @param subtree structure shared by the instances.
+     * @param tick_mode tick mode of the sequences and fallbacks of the subtree.
+     */
+    SubtreeInstanceNode(const std::string& name, std::shared_ptr<const SharedSubtree> subtree,
+                        TickMode tick_mode = TickMode::STEP)
+        : NodeInterface(name), subtree_{std::move(subtree)}, tick_mode_{tick_mode} {
+        if (subtree_ == nullptr) {
+            throw std::invalid_argument("subtree cannot be nullptr");
+        }
+        state_.reset(new uint32_t[subtree_->getStateSize()]());
+    };
+
+    /**
+     * @brief this method implements the functionality of the subtree instance node.
+     *
+     * @returns the result of the subtree.
+     */
+    NodeResult tick() override { return subtree_->tick(state_.get(), tick_mode_); }
+
+    /**
+     * @brief Selects how the sequences and fallbacks of the subtree advance through their children.
+     *
+     * @param mode new tick mode of the node.
+     */
+    void setTickMode(TickMode mode) override { tick_mode_ = mode; }
+
+    /**
+     * @brief Restarts the subtree from its first child.
+     */
+    void reset() { std::fill(state_.get(), state_.get() + subtree_->getStateSize(), 0u); }
+
+    /**
+     * @brief Restarts the subtree from its first child. The leaves are shared with the rest of
+     *        the instances, so they aren't halted.
+     */
+    void halt() override { reset(); }
+
+   private:
+    std::shared_ptr<const SharedSubtree> subtree_;
+    std::unique_ptr<uint32_t[]> state_;
+    TickMode tick_mode_;
+};
+}  // namespace behavior_tree
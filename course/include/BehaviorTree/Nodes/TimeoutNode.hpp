@@ -0,0 +1,90 @@
+/**
+ * @file TimeoutNode.hpp
+ * @brief Behavior of the node:
+ *          - With every call to tick, it will tick its child and return its result.
+ *          - When the child has been returning RUNNING for longer than the timeout, it
+ *            halts the child and returns FAILURE without ticking it. The next tick starts over.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+// Challenge includes
+#include "BehaviorTree/Clock.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+class TimeoutNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new TimeoutNode object
+     *
+     * @param name name of the node.
+     * @param child child to be bounded.
+     * @param timeout maximum time the child can keep returning RUNNING.
+     * @param clock clock used to measure the timeout.
+     */
+    TimeoutNode(const std::string& name, std::shared_ptr<NodeInterface> child, Clock::Duration timeout,
+                std::shared_ptr<const Clock> clock = std::make_shared<SteadyClock>())
+        : NodeInterface(name), child_{child}, clock_{clock}, timeout_{timeout} {
+        if (child_ == nullptr) {
+            throw std::invalid_argument("Child cannot be nullptr");
+        }
+        if (clock_ == nullptr) {
+            throw std::invalid_argument("Clock cannot be nullptr");
+        }
+    };
+
+    /**
+     * @brief this method implements the functionality of the timeout node.
+     *
+     * @returns FAILURE when the timeout elapsed, the result of the child otherwise.
+     */
+    NodeResult tick() override {
+        const Clock::TimePoint now = clock_->now();
+        if (!running_) {
+            start_ = now;
+        } else if (now - start_ >= timeout_) {
+            running_ = false;
+            child_->halt();
+            return NodeResult::FAILURE;
+        }
+        const NodeResult result = child_->observedTick();
+        running_ = (result == NodeResult::RUNNING);
+        return result;
+    }
+
+    /**
+     * @brief Halts the child. The next tick starts over.
+     */
+    void halt() override {
+        running_ = false;
+        child_->halt();
+    }
+
+    /**
+     * @brief Calls visitor with the child of the node.
+     *
+     * @param visitor called with the child.
+     */
+    void visitChildren(const Visitor& visitor) override { visitor(*child_); }
+
+   private:
+    std::shared_ptr<NodeInterface> child_;
+    std::shared_ptr<const Clock> clock_;
+    Clock::Duration timeout_;
+    bool running_ = false;
+    Clock::TimePoint start_{};
+};
+}  // namespace behavior_tree
@@ -0,0 +1,205 @@
+/**
+ * @file UtilitySelectorNode.hpp
+ * @brief Behavior of the node:
+ *          - With every call to tick, it scores every child from the blackboard inputs
+ *            and ticks the child with the highest score, returning its result.
+ *          - The score of a child is its bias plus the weighted sum of the inputs.
+ *            Missing inputs count as 0.
+ *          - With hysteresis, the selected child only changes when another child scores
+ *            more than `hysteresis` above it.
+ *          - When the selected child changes while it is RUNNING, it is halted.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Scoring parameters of a child: bias + sum(weights[i] * input[i]).
+ */
+struct UtilityScoring {
+    float bias;
+    std::vector<float> weights;
+};
+
+class UtilitySelectorNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new UtilitySelectorNode object
+     *
+     * @param name name of the node.
+     * @param blackboard blackboard where the inputs are read (as double or float).
+     * @param input_keys keys of the inputs.
+     * @param children candidates to be selected.
+     * @param scorings scoring parameters of every child, one weight per input.
+     * @param hysteresis score margin needed to change the selected child.
+     */
+    UtilitySelectorNode(const std::string& name, std::shared_ptr<const Blackboard> blackboard,
+                        std::vector<std::string> input_keys, std::vector<std::shared_ptr<NodeInterface>> children,
+                        const std::vector<UtilityScoring>& scorings, float hysteresis = 0.0f)
+        : NodeInterface(name),
+          blackboard_{blackboard},
+          input_keys_{std::move(input_keys)},
+          children_{std::move(children)},
+          hysteresis_{hysteresis} {
+        if (blackboard_ == nullptr) {
+            throw std::invalid_argument("blackboard cannot be nullptr");
+        }
+        if (scorings.size() != children_.size()) {
+            throw std::invalid_argument("there must be one scoring per child");
+        }
+        for (const auto& child : children_) {
+            if (child == nullptr) {
+                throw std::invalid_argument("child cannot be nullptr");
+            }
+        }
+        // Parameters are stored input-major, so every input is applied to all the
+        // candidates with a single contiguous loop.
+        const size_t candidates = children_.size();
+        biases_.resize(candidates);
+        weights_.resize(candidates * input_keys_.size());
+        for (size_t candidate = 0; candidate < candidates; ++candidate) {
+            if (scorings[candidate].weights.size() != input_keys_.size()) {
+                throw std::invalid_argument("there must be one weight per input");
+            }
+            biases_[candidate] = scorings[candidate].bias;
+            for (size_t input = 0; input < input_keys_.size(); ++input) {
+                weights_[input * candidates + candidate] = scorings[candidate].weights[input];
+            }
+        }
+        inputs_.resize(input_keys_.size());
+        scores_.resize(candidates);
+    };
+
+    /**
+     * @brief this method implements the functionality of the utility selector node.
+     *
+     * @returns the result of the selected child, SUCCESS when there are no children.
+     */
+    NodeResult tick() override {
+        if (children_.empty()) {
+            return NodeResult::SUCCESS;
+        }
+        for (size_t input = 0; input < input_keys_.size(); ++input) {
+            inputs_[input] = readInput(input_keys_[input]);
+        }
+        scoreCandidates(biases_.data(), weights_.data(), inputs_.data(), inputs_.size(), children_.size(),
+                        scores_.data());
+
+        const size_t best = bestCandidate(scores_.data(), scores_.size());
+        if ((selected_ == kNoSelection) || (scores_[best] > scores_[selected_] + hysteresis_)) {
+            if ((selected_ != kNoSelection) && (selected_ != best) && (last_result_ == NodeResult::RUNNING)) {
+                children_[selected_]->halt();
+            }
+            selected_ = best;
+        }
+        last_result_ = children_[selected_]->observedTick();
+        return last_result_;
+    }
+
+    /**
+     * @brief Returns the index of the child selected in the last tick, kNoSelection before the first one.
+     */
+    size_t getSelected() const { return selected_; }
+
+    /**
+     * @brief Returns the scores computed in the last tick, one per child.
+     */
+    const std::vector<float>& getScores() const { return scores_; }
+
+    /** @brief Value of getSelected before the first tick. */
+    static constexpr size_t kNoSelection = SIZE_MAX;
+
+    /**
+     * @brief Scores every candidate: scores[c] = biases[c] + sum_i(weights[i * count + c] * inputs[i]).
+     *        The inner loop runs over contiguous arrays without aliasing, so the compiler
+     *        vectorizes it.
+     *
+     * @param biases bias of every candidate.
+     * @param weights weights, input-major.
+     * @param inputs value of every input.
+     * @param input_count amount of inputs.
+     * @param candidate_count amount of candidates.
+     * @param scores output with the score of every candidate.
+     */
+    static void scoreCandidates(const float* __restrict biases, const float* __restrict weights,
+                                const float* __restrict inputs, size_t input_count, size_t candidate_count,
+                                float* __restrict scores) {
+        for (size_t candidate = 0; candidate < candidate_count; ++candidate) {
+            scores[candidate] = biases[candidate];
+        }
+        for (size_t input = 0; input < input_count; ++input) {
+            const float value = inputs[input];
+            const float* __restrict row = weights + input * candidate_count;
+            for (size_t candidate = 0; candidate < candidate_count; ++candidate) {
+                scores[candidate] += row[candidate] * value;
+            }
+        }
+    }
+
+    /**
+     * @brief Calls visitor with every child of the node, in order.
+     *
+     * @param visitor called with every child.
+     */
+    void visitChildren(const Visitor& visitor) override {
+        for (auto& child : children_) {
+            visitor(*child);
+        }
+    }
+
+   private:
+    float readInput(const std::string& key) const {
+        const Any* object = blackboard_->tryGet(key);
+        if (object == nullptr) {
+            return 0.0f;
+        }
+        if (const double* value = object->tryGet<double>()) {
+            return static_cast<float>(*value);
+        }
+        if (const float* value = object->tryGet<float>()) {
+            return *value;
+        }
+        return 0.0f;
+    }
+
+    static size_t bestCandidate(const float* scores, size_t count) {
+        size_t best = 0;
+        for (size_t candidate = 1; candidate < count; ++candidate) {
+            if (scores[candidate] > scores[best]) {
+                best = candidate;
+            }
+        }
+        return best;
+    }
+
+    std::shared_ptr<const Blackboard> blackboard_;
+    std::vector<std::string> input_keys_;
+    std::vector<std::shared_ptr<NodeInterface>> children_;
+    float hysteresis_;
+    std::vector<float> biases_;
+    std::vector<float> weights_;
+    std::vector<float> inputs_;
+    std::vector<float> scores_;
+    size_t selected_ = kNoSelection;
+    NodeResult last_result_ = NodeResult::SUCCESS;
+};
+}  // namespace behavior_tree
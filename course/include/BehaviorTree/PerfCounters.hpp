@@ -0,0 +1,144 @@
+/**
+ * @file PerfCounters.hpp
+ * @brief Group of hardware performance counters read through Linux perf_event_open.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace behavior_tree {
+
+/**
+ * @brief Opens the hardware counters of the calling thread as a single perf group, so
+ *        all of them are read with one system call. The counters that the kernel (or the
+ *        container) refuses to open are reported as unavailable and read as zero.
+ */
+class PerfCounters {
+   public:
+    /** @brief Hardware events that are counted. */
+    enum Counter : size_t { CYCLES = 0, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, COUNTER_COUNT };
+
+    /** @brief Values of every counter at a given point in time. */
+    using Sample = std::array<uint64_t, COUNTER_COUNT>;
+
+    /**
+     * @brief Construct a new PerfCounters object and starts counting.
+     */
+    PerfCounters() {
+        fds_.fill(-1);
+        available_.fill(false);
+#ifdef __linux__
+        const std::array<uint64_t, COUNTER_COUNT> configs{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                          PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        int leader = -1;
+        for (size_t counter = 0; counter < COUNTER_COUNT; ++counter) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[counter];
+            attr.disabled = (leader == -1) ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+            if (fd == -1) {
+                continue;
+            }
+            if (leader == -1) {
+                leader = fd;
+            }
+            fds_[counter] = fd;
+            available_[counter] = true;
+            ++opened_count_;
+        }
+        leader_ = leader;
+        if (leader_ != -1) {
+            ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Stops counting and releases the counters.
+     */
+    ~PerfCounters() {
+#ifdef __linux__
+        for (const int fd : fds_) {
+            if (fd != -1) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Returns true when at least one counter could be opened.
+     */
+    bool available() const { return leader_ != -1; }
+
+    /**
+     * @brief Returns true when the given counter could be opened.
+     *
+     * @param counter counter to check.
+     */
+    bool available(Counter counter) const { return available_[counter]; }
+
+    /**
+     * @brief Reads the current value of every counter.
+     *
+     * @param sample output with the values, unavailable counters are set to zero.
+     * @return true when the counters could be read.
+     */
+    bool read(Sample& sample) const {
+        sample.fill(0);
+#ifdef __linux__
+        if (leader_ == -1) {
+            return false;
+        }
+        // Layout of PERF_FORMAT_GROUP: number of values followed by the values, in opening order.
+        std::array<uint64_t, COUNTER_COUNT + 1> buffer;
+        const ssize_t bytes = ::read(leader_, buffer.data(), sizeof(buffer));
+        if (bytes < static_cast<ssize_t>(sizeof(uint64_t) * (opened_count_ + 1))) {
+            return false;
+        }
+        size_t value = 1;
+        for (size_t counter = 0; counter < COUNTER_COUNT; ++counter) {
+            if (available_[counter]) {
+                sample[counter] = buffer[value++];
+            }
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+   private:
+    std::array<int, COUNTER_COUNT> fds_;
+    std::array<bool, COUNTER_COUNT> available_;
+    size_t opened_count_ = 0;
+    int leader_ = -1;
+};
+
+}  // namespace behavior_tree
@@ -0,0 +1,529 @@
+/**
+ * @file PersistentBlackboard.hpp
+ * @brief Blackboard backend that keeps trivially copyable values in a memory-mapped file,
+ *        so a restarted process reattaches to them instead of rebuilding them, and other
+ *        processes can read them in place.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// System libraries
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace behavior_tree {
+
+/**
+ * @brief On-disk format, stable across builds with the same version:
+ *          - Header.
+ *          - slot_count slots of slotStride(value_capacity) bytes, an open-addressing hash table by key.
+ *        Each slot holds its key, the hash of its type and two buffers of value_capacity bytes.
+ *        A write goes to the buffer that isn't current and then publishes it by bumping the
+ *        generation of the slot (the current buffer is generation & 1), so a process killed at
+ *        any point leaves the previous value intact. Every buffer carries a checksum that is
+ *        verified when the file is reattached, in case the pages hit the disk torn.
+ */
+namespace persistent_blackboard {
+
+constexpr uint64_t kMagic = 0x4254504552534231ull;  // "BTPERSB1"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kKeySize = 64;
+constexpr size_t kAlignment = 64;
+
+/** @brief States of a slot. A slot is claimed while its key is being written. */
+enum SlotState : uint32_t { kFree = 0, kClaimed = 1, kReady = 2 };
+
+struct Header {
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    uint32_t slot_count;
+    uint32_t value_capacity;
+    uint32_t reserved;
+    /** @brief Amount of values written so far, across restarts. */
+    std::atomic<uint64_t> write_count;
+};
+
+struct Buffer {
+    uint64_t generation;
+    uint64_t checksum;
+    uint32_t size;
+    uint32_t reserved;
+};
+
+struct Slot {
+    std::atomic<uint32_t> state;
+    uint32_t key_length;
+    uint64_t type_hash;
+    char key[kKeySize];
+    /** @brief Generation of the current value, 0 when the key has no value yet. */
+    std::atomic<uint64_t> generation;
+    /** @brief Generation of the last value the writer started to write. */
+    std::atomic<uint64_t> writing;
+    Buffer buffers[2];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory needs lock-free atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared memory needs lock-free atomics");
+
+constexpr size_t alignUp(size_t value) { return (value + kAlignment - 1) / kAlignment * kAlignment; }
+
+/** @brief Offset of the values within a slot. */
+constexpr size_t kDataOffset = alignUp(sizeof(Slot));
+
+inline size_t slotStride(uint32_t value_capacity) { return alignUp(kDataOffset + 2 * size_t{value_capacity}); }
+
+inline size_t mappingSize(uint32_t slot_count, uint32_t value_capacity) {
+    return alignUp(sizeof(Header)) + slotStride(value_capacity) * slot_count;
+}
+
+/** @brief FNV-1a, used for the keys, the checksums and the type hashes. */
+inline uint64_t hash(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        seed = (seed ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return seed;
+}
+
+inline uint64_t checksum(uint64_t generation, const void* data, uint32_t size) {
+    uint64_t value = hash(&generation, sizeof(generation));
+    value = hash(&size, sizeof(size), value);
+    return hash(data, size, value);
+}
+
+/**
+ * @brief Hash of a type that is the same in every process built by the same compiler.
+ *        TypeId can't be used here, it is an address.
+ */
+template <typename T>
+uint64_t typeHash() {
+    const size_t layout[2] = {sizeof(T), alignof(T)};
+    return hash(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1, hash(layout, sizeof(layout)));
+}
+
+/** @brief Part of the writer and the readers that reads the mapping. */
+class Mapping {
+   public:
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+
+    ~Mapping() { unmap(); }
+
+    /**
+     * @brief Returns true when the key has a value.
+     *
+     * @param key key to look for.
+     */
+    bool contains(std::string_view key) const {
+        const Slot* slot = find(key);
+        return (slot != nullptr) && (slot->generation.load(std::memory_order_acquire) != 0);
+    }
+
+    /**
+     * @brief Calls visitor with the value stored in the mapping, without copying it.
+     *        The writer may overwrite the value while visitor runs; in that case the function
+     *        returns false and whatever visitor computed must be discarded.
+     *
+     * @param key key of the value.
+     * @param visitor called with a const T&.
+     * @return true when the key holds a T and visitor saw a consistent value.
+     */
+    template <typename T, typename Visitor>
+    bool visit(std::string_view key, Visitor&& visitor) const {
+        const Slot* slot = find(key);
+        if ((slot == nullptr) || (slot->type_hash != typeHash<T>())) {
+            return false;
+        }
+        const uint64_t generation = slot->generation.load(std::memory_order_acquire);
+        if (generation == 0) {
+            return false;
+        }
+        visitor(*reinterpret_cast<const T*>(data(*slot, generation & 1)));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // The buffer is only reused by the write after the next one.
+        return slot->writing.load(std::memory_order_relaxed) < generation + 2;
+    }
+
+    /**
+     * @brief Copies a value out of the mapping, retrying while it is being overwritten.
+     *
+     * @param key key of the value.
+     * @param value output.
+     * @return true when the key holds a T.
+     */
+    template <typename T>
+    bool get(std::string_view key, T& value) const {
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values are persistent");
+        for (;;) {
+            const Slot* slot = find(key);
+            if ((slot == nullptr) || (slot->type_hash != typeHash<T>()) ||
+                (slot->generation.load(std::memory_order_acquire) == 0)) {
+                return false;
+            }
+            if (visit<T>(key, [&value](const T& stored) { std::memcpy(&value, &stored, sizeof(T)); })) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the generation of the value of a key, 0 when it has no value.
+     *        It grows by one with every write, also across restarts (unless a torn value is rolled back).
+     *
+     * @param key key of the value.
+     */
+    uint64_t getGeneration(std::string_view key) const {
+        const Slot* slot = find(key);
+        return (slot == nullptr) ? 0 : slot->generation.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the amount of values written so far, across restarts.
+     */
+    uint64_t getWriteCount() const { return header_->write_count.load(std::memory_order_relaxed); }
+
+    uint32_t getSlotCount() const { return slot_count_; }
+    uint32_t getValueCapacity() const { return value_capacity_; }
+
+   protected:
+    Mapping() = default;
+
+    /**
+     * @brief Maps the file and checks its header. Returns false when it is empty or its
+     *        creation was interrupted, and then it leaves it unmapped.
+     */
+    bool map(int fd, const std::string& path, bool writable) {
+        struct stat status;
+        if (::fstat(fd, &status) == -1) {
+            throw std::runtime_error("Cannot stat " + path + ": " + std::strerror(errno));
+        }
+        if (status.st_size == 0) {
+            return false;
+        }
+        size_ = static_cast<size_t>(status.st_size);
+        if (size_ < sizeof(Header)) {
+            throw std::runtime_error(path + " is not a persistent blackboard");
+        }
+        mapAt(fd, path, writable);
+        // The magic is stored last when the file is created, so without it the file was never complete.
+        if (header_->magic.load(std::memory_order_acquire) == 0) {
+            unmap();
+            return false;
+        }
+        if ((header_->magic.load(std::memory_order_acquire) != kMagic) || (header_->version != kVersion) ||
+            (mappingSize(header_->slot_count, header_->value_capacity) > size_)) {
+            throw std::runtime_error(path + " is not a compatible persistent blackboard");
+        }
+        slot_count_ = header_->slot_count;
+        value_capacity_ = header_->value_capacity;
+        return true;
+    }
+
+    void mapAt(int fd, const std::string& path, bool writable) {
+        const int protection = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void* mapping = ::mmap(nullptr, size_, protection, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Cannot map " + path + ": " + std::strerror(errno));
+        }
+        mapping_ = static_cast<uint8_t*>(mapping);
+        header_ = reinterpret_cast<Header*>(mapping_);
+    }
+
+    void unmap() {
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, size_);
+            mapping_ = nullptr;
+            header_ = nullptr;
+        }
+    }
+
+    Slot& slotAt(uint32_t index) const {
+        return *reinterpret_cast<Slot*>(mapping_ + alignUp(sizeof(Header)) + slotStride(value_capacity_) * index);
+    }
+
+    uint8_t* data(const Slot& slot, uint64_t buffer) const {
+        return reinterpret_cast<uint8_t*>(const_cast<Slot*>(&slot)) + kDataOffset + value_capacity_ * buffer;
+    }
+
+    /**
+     * @brief Probes the table for a key.
+     *
+     * @param key key to look for.
+     * @param free_slot if not nullptr, set to the first free slot of the probe when the key is missing.
+     * @return Slot* slot of the key, nullptr when it is missing.
+     */
+    Slot* find(std::string_view key, Slot** free_slot = nullptr) const {
+        if ((key.size() >= kKeySize) || (slot_count_ == 0)) {
+            return nullptr;
+        }
+        const uint64_t start = hash(key.data(), key.size()) % slot_count_;
+        for (uint32_t probe = 0; probe < slot_count_; ++probe) {
+            Slot& slot = slotAt(static_cast<uint32_t>((start + probe) % slot_count_));
+            const uint32_t state = slot.state.load(std::memory_order_acquire);
+            if (state == kFree) {
+                if (free_slot != nullptr) {
+                    *free_slot = &slot;
+                }
+                return nullptr;
+            }
+            if ((state == kReady) && (std::string_view(slot.key, slot.key_length) == key)) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t size_ = 0;
+    uint8_t* mapping_ = nullptr;
+    Header* header_ = nullptr;
+    uint32_t slot_count_ = 0;
+    uint32_t value_capacity_ = 0;
+};
+
+}  // namespace persistent_blackboard
+
+/** @brief Geometry of a new persistent blackboard. Reattaching keeps the one of the file. */
+struct PersistentBlackboardConfig {
+    /** @brief Maximum amount of keys. */
+    uint32_t slot_count = 1024;
+    /** @brief Maximum size of a value, in bytes. */
+    uint32_t value_capacity = 256;
+};
+
+/** @brief What was repaired when the file was reattached. */
+struct PersistentBlackboardRecovery {
+    /** @brief Keys whose value survived. */
+    size_t entries = 0;
+    /** @brief Values found torn, replaced by the previous value of the key. */
+    size_t rolled_back = 0;
+    /** @brief Keys left without value, because both buffers were torn. */
+    size_t lost = 0;
+    /** @brief Keys that were being created, dropped. */
+    size_t discarded_claims = 0;
+};
+
+/**
+ * @brief Writer of a persistent blackboard. It creates the file or reattaches to it,
+ *        repairing what a crash left behind. Only one writer can use a file at a time, also
+ *        within a process (its descriptor holds a flock); any amount of
+ *        PersistentBlackboardReader can read it meanwhile.
+ */
+class PersistentBlackboard : public persistent_blackboard::Mapping {
+   public:
+    /**
+     * @brief Creates the file, or reattaches to it when it already exists.
+     *
+     * @param path path of the file.
+     * @param config geometry of the file when it is created.
+     */
+    explicit PersistentBlackboard(const std::string& path, PersistentBlackboardConfig config = {}) {
+        using namespace persistent_blackboard;
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ == -1) {
+            throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+        }
+        try {
+            // Unlike lockf, flock belongs to this descriptor: closing another one of the file keeps it.
+            if (::flock(fd_, LOCK_EX | LOCK_NB) == -1) {
+                throw std::runtime_error(path + " is already used by another writer");
+            }
+            if (map(fd_, path, true)) {
+                recover();
+            } else {
+                create(path, config);
+            }
+        } catch (...) {
+            ::close(fd_);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Unmaps the file and releases the lock. It doesn't wait for the pages to reach the disk.
+     */
+    ~PersistentBlackboard() { ::close(fd_); }
+
+    /**
+     * @brief Stores a value. The key is created the first time, with the type of the value;
+     *        it can't be written with another type afterwards.
+     *
+     * @param key key of the value, shorter than persistent_blackboard::kKeySize.
+     * @param value value to be stored.
+     */
+    template <typename T>
+    void set(std::string_view key, const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values are persistent");
+        using namespace persistent_blackboard;
+        if (sizeof(T) > value_capacity_) {
+            throw std::invalid_argument("value is bigger than the capacity of the blackboard");
+        }
+        Slot* slot = claim(key, typeHash<T>());
+        if (slot->type_hash != typeHash<T>()) {
+            throw std::invalid_argument("key " + std::string(key) + " holds another type");
+        }
+        const uint64_t generation = slot->generation.load(std::memory_order_relaxed) + 1;
+        Buffer& buffer = slot->buffers[generation & 1];
+        // Readers still visiting this buffer find out through writing, as in a seqlock.
+        slot->writing.store(generation, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(data(*slot, generation & 1), &value, sizeof(T));
+        buffer.generation = generation;
+        buffer.size = static_cast<uint32_t>(sizeof(T));
+        buffer.checksum = checksum(generation, &value, buffer.size);
+        // Publishing the generation is the commit point.
+        slot->generation.store(generation, std::memory_order_release);
+        header_->write_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Blocks until the mapped pages reach the disk. Without it, the values survive a
+     *        crash of the process but not one of the machine.
+     */
+    void flush() {
+        if (::msync(mapping_, size_, MS_SYNC) == -1) {
+            throw std::runtime_error(std::string("Cannot flush persistent blackboard: ") + std::strerror(errno));
+        }
+    }
+
+    /**
+     * @brief Returns what was repaired when the file was reattached.
+     */
+    const PersistentBlackboardRecovery& getRecovery() const { return recovery_; }
+
+   private:
+    void create(const std::string& path, PersistentBlackboardConfig config) {
+        using namespace persistent_blackboard;
+        if ((config.slot_count == 0) || (config.value_capacity == 0)) {
+            throw std::invalid_argument("slot_count and value_capacity cannot be 0");
+        }
+        // Values are kept aligned within their buffers.
+        config.value_capacity = static_cast<uint32_t>(alignUp(config.value_capacity));
+        size_ = mappingSize(config.slot_count, config.value_capacity);
+        // Drops whatever an interrupted creation left, before sizing the file.
+        if ((::ftruncate(fd_, 0) == -1) || (::ftruncate(fd_, static_cast<off_t>(size_)) == -1)) {
+            throw std::runtime_error("Cannot size " + path + ": " + std::strerror(errno));
+        }
+        mapAt(fd_, path, true);
+        // ftruncate zero-fills: every slot is free and every atomic is valid.
+        header_->version = kVersion;
+        header_->slot_count = config.slot_count;
+        header_->value_capacity = config.value_capacity;
+        slot_count_ = config.slot_count;
+        value_capacity_ = config.value_capacity;
+        header_->magic.store(kMagic, std::memory_order_release);
+    }
+
+    /** @brief Drops the keys that were being created and rolls back the torn values. */
+    void recover() {
+        using namespace persistent_blackboard;
+        for (uint32_t index = 0; index < slot_count_; ++index) {
+            Slot& slot = slotAt(index);
+            const uint32_t state = slot.state.load(std::memory_order_relaxed);
+            if (state == kClaimed) {
+                // A claimed slot is always the last one of its probe, so freeing it keeps the rest reachable.
+                std::memset(static_cast<void*>(&slot), 0, kDataOffset);
+                ++recovery_.discarded_claims;
+                continue;
+            }
+            if (state != kReady) {
+                continue;
+            }
+            const uint64_t generation = slot.generation.load(std::memory_order_relaxed);
+            slot.writing.store(generation, std::memory_order_relaxed);
+            if ((generation == 0) || isIntact(slot, generation)) {
+                ++recovery_.entries;
+            } else if ((generation > 1) && isIntact(slot, generation - 1)) {
+                slot.generation.store(generation - 1, std::memory_order_release);
+                slot.writing.store(generation - 1, std::memory_order_relaxed);
+                ++recovery_.entries;
+                ++recovery_.rolled_back;
+            } else {
+                slot.generation.store(0, std::memory_order_release);
+                slot.writing.store(0, std::memory_order_relaxed);
+                ++recovery_.lost;
+            }
+        }
+    }
+
+    bool isIntact(const persistent_blackboard::Slot& slot, uint64_t generation) const {
+        const persistent_blackboard::Buffer& buffer = slot.buffers[generation & 1];
+        if ((buffer.generation != generation) || (buffer.size > value_capacity_)) {
+            return false;
+        }
+        return buffer.checksum == persistent_blackboard::checksum(generation, data(slot, generation & 1), buffer.size);
+    }
+
+    /** @brief Returns the slot of the key, creating it when it is missing. */
+    persistent_blackboard::Slot* claim(std::string_view key, uint64_t type_hash) {
+        using namespace persistent_blackboard;
+        if (key.size() >= kKeySize) {
+            throw std::invalid_argument("key is too long: " + std::string(key));
+        }
+        Slot* free_slot = nullptr;
+        Slot* slot = find(key, &free_slot);
+        if (slot != nullptr) {
+            return slot;
+        }
+        if (free_slot == nullptr) {
+            throw std::runtime_error("persistent blackboard is full");
+        }
+        free_slot->state.store(kClaimed, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(free_slot->key, key.data(), key.size());
+        free_slot->key_length = static_cast<uint32_t>(key.size());
+        free_slot->type_hash = type_hash;
+        free_slot->state.store(kReady, std::memory_order_release);
+        return free_slot;
+    }
+
+    int fd_ = -1;
+    PersistentBlackboardRecovery recovery_;
+};
+
+/**
+ * @brief Read-only view of a persistent blackboard, usually from another process. It maps the
+ *        file read-only and reads the values in place.
+ */
+class PersistentBlackboardReader : public persistent_blackboard::Mapping {
+   public:
+    /**
+     * @brief Attaches to the file of a PersistentBlackboard.
+     *
+     * @param path path of the file.
+     */
+    explicit PersistentBlackboardReader(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            throw std::runtime_error("Cannot open " + path + ": " + std::strerror(errno));
+        }
+        try {
+            if (!map(fd, path, false)) {
+                throw std::runtime_error(path + " is not a persistent blackboard");
+            }
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+    }
+};
+
+}  // namespace behavior_tree
@@ -0,0 +1,367 @@
+/**
+ * @file RemoteAction.hpp
+ * @brief Client of actions executed by other local processes. Every request of a tree goes
+ *        through a single Unix domain socket connection: requests issued during a tick are
+ *        written together when the tick ends, and responses are read without blocking when
+ *        the next one starts.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// System libraries
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TickObserver.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Wire protocol. Every frame is a FrameHeader followed by `length` bytes, in host
+ *        byte order (both ends run on the same machine).
+ *          - REQUEST: the name of the action (action_length bytes), then its arguments.
+ *          - RESPONSE: result holds the NodeResult, the payload is the output of the action.
+ */
+namespace remote_action {
+
+enum FrameType : uint8_t { kRequest = 1, kResponse = 2 };
+
+struct FrameHeader {
+    uint32_t length;
+    uint32_t request_id;
+    uint8_t type;
+    uint8_t result;
+    uint16_t action_length;
+};
+
+static_assert(sizeof(FrameHeader) == 12, "the frame header is part of the protocol");
+
+/** @brief Frames with a bigger payload are a protocol error. */
+constexpr uint32_t kMaxPayload = 1u << 20;
+
+/**
+ * @brief Appends a frame to a buffer.
+ *
+ * @param buffer output buffer.
+ * @param header header of the frame, length is filled in.
+ * @param first first part of the payload.
+ * @param second second part of the payload.
+ */
+inline void appendFrame(std::vector<uint8_t>& buffer, FrameHeader header, std::string_view first,
+                        std::string_view second = {}) {
+    header.length = static_cast<uint32_t>(first.size() + second.size());
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&header);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(header));
+    buffer.insert(buffer.end(), first.begin(), first.end());
+    buffer.insert(buffer.end(), second.begin(), second.end());
+}
+
+/**
+ * @brief Splits a stream of bytes into frames.
+ */
+class FrameParser {
+   public:
+    /**
+     * @brief Appends bytes received from the socket.
+     */
+    void append(const uint8_t* data, size_t size) { buffer_.insert(buffer_.end(), data, data + size); }
+
+    /**
+     * @brief Extracts the next complete frame.
+     *
+     * @param header header of the frame.
+     * @param payload payload of the frame.
+     * @return true when a frame was extracted.
+     */
+    bool next(FrameHeader& header, std::string& payload) {
+        if (buffer_.size() - offset_ < sizeof(FrameHeader)) {
+            compact();
+            return false;
+        }
+        std::memcpy(&header, buffer_.data() + offset_, sizeof(header));
+        if ((header.length > kMaxPayload) || (header.action_length > header.length)) {
+            throw std::runtime_error("remote action: invalid frame");
+        }
+        if (buffer_.size() - offset_ < sizeof(FrameHeader) + header.length) {
+            compact();
+            return false;
+        }
+        const auto* begin = reinterpret_cast<const char*>(buffer_.data() + offset_ + sizeof(FrameHeader));
+        payload.assign(begin, header.length);
+        offset_ += sizeof(FrameHeader) + header.length;
+        return true;
+    }
+
+   private:
+    void compact() {
+        buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(offset_));
+        offset_ = 0;
+    }
+
+    std::vector<uint8_t> buffer_;
+    size_t offset_ = 0;
+};
+
+/** @brief Builds the address of a socket path. */
+inline sockaddr_un makeAddress(const std::string& socket_path) {
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("socket path is too long: " + socket_path);
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+    return address;
+}
+
+}  // namespace remote_action
+
+/** @brief Response to a remote action. */
+struct RemoteActionResponse {
+    NodeResult result;
+    std::string output;
+};
+
+/**
+ * @brief Connection shared by the remote actions of a tree. Added as a tick observer of the
+ *        BTManager, it reads the responses at the start of every tick of the tree and writes
+ *        the requests of the tick, in a single write, at its end. Without it, poll and flush
+ *        have to be called by hand.
+ *        When the connection is lost, every pending request (and any later one) fails.
+ */
+class RemoteActionClient : public TickObserver {
+   public:
+    /**
+     * @brief Connects to the server.
+     *
+     * @param socket_path path of the Unix domain socket of the server.
+     */
+    explicit RemoteActionClient(const std::string& socket_path) {
+        const sockaddr_un address = remote_action::makeAddress(socket_path);
+        fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd_ == -1) {
+            throw std::runtime_error(std::string("Cannot create socket: ") + std::strerror(errno));
+        }
+        if (::connect(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1) {
+            const std::string error = std::strerror(errno);
+            ::close(fd_);
+            throw std::runtime_error("Cannot connect to " + socket_path + ": " + error);
+        }
+        // Connected synchronously, the tick path never blocks afterwards.
+        ::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL) | O_NONBLOCK);
+    }
+
+    RemoteActionClient(const RemoteActionClient&) = delete;
+    RemoteActionClient& operator=(const RemoteActionClient&) = delete;
+
+    ~RemoteActionClient() { disconnect(); }
+
+    /**
+     * @brief Queues a request. It is sent by the next flush.
+     *
+     * @param action name of the action.
+     * @param arguments arguments of the action, opaque to the client.
+     * @return uint32_t id of the request.
+     */
+    uint32_t submit(std::string_view action, std::string_view arguments) {
+        if (action.size() > UINT16_MAX) {
+            throw std::invalid_argument("action name is too long");
+        }
+        if (action.size() + arguments.size() > remote_action::kMaxPayload) {
+            throw std::invalid_argument("request is too big");
+        }
+        // Zero is never used as an id, nodes use it to mean "no request".
+        next_request_id_ += (next_request_id_ == 0) ? 1 : 0;
+        const uint32_t request_id = next_request_id_++;
+        if (fd_ == -1) {
+            responses_[request_id] = RemoteActionResponse{NodeResult::FAILURE, ""};
+            return request_id;
+        }
+        remote_action::FrameHeader header{0, request_id, remote_action::kRequest, 0,
+                                          static_cast<uint16_t>(action.size())};
+        remote_action::appendFrame(output_, header, action, arguments);
+        pending_.insert(request_id);
+        return request_id;
+    }
+
+    /**
+     * @brief Takes the response of a request, if it arrived.
+     *
+     * @param request_id id returned by submit.
+     * @param response output.
+     * @return true when the response arrived.
+     */
+    bool takeResponse(uint32_t request_id, RemoteActionResponse& response) {
+        const auto search = responses_.find(request_id);
+        if (search == responses_.end()) {
+            return false;
+        }
+        response = std::move(search->second);
+        responses_.erase(search);
+        return true;
+    }
+
+    /**
+     * @brief Forgets a request: its response is dropped, whether it arrived or not. The
+     *        request itself may have been sent already.
+     *
+     * @param request_id id returned by submit.
+     */
+    void cancel(uint32_t request_id) {
+        pending_.erase(request_id);
+        responses_.erase(request_id);
+    }
+
+    /**
+     * @brief Writes the queued requests, in a single write when the socket accepts them all.
+     *        What doesn't fit is written by the next flush.
+     */
+    void flush() {
+        if ((fd_ == -1) || (output_offset_ == output_.size())) {
+            return;
+        }
+        const ssize_t written =
+            ::send(fd_, output_.data() + output_offset_, output_.size() - output_offset_, MSG_NOSIGNAL);
+        if (written < 0) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+                disconnect();
+            }
+            return;
+        }
+        ++write_count_;
+        output_offset_ += static_cast<size_t>(written);
+        if (output_offset_ == output_.size()) {
+            output_.clear();
+            output_offset_ = 0;
+        }
+    }
+
+    /**
+     * @brief Reads the responses that arrived, without blocking.
+     */
+    void poll() {
+        if (fd_ == -1) {
+            return;
+        }
+        uint8_t chunk[4096];
+        for (;;) {
+            const ssize_t received = ::recv(fd_, chunk, sizeof(chunk), 0);
+            if (received > 0) {
+                parser_.append(chunk, static_cast<size_t>(received));
+                continue;
+            }
+            if ((received < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+                break;
+            }
+            if ((received < 0) && (errno == EINTR)) {
+                continue;
+            }
+            // Closed by the server, or broken.
+            parseResponses();
+            disconnect();
+            return;
+        }
+        parseResponses();
+    }
+
+    /**
+     * @brief Returns true while the connection is alive.
+     */
+    bool isConnected() const { return fd_ != -1; }
+
+    /**
+     * @brief Returns the amount of writes made to the socket.
+     */
+    uint64_t getWriteCount() const { return write_count_; }
+
+    /**
+     * @brief Returns the amount of requests waiting for a response.
+     */
+    size_t getPendingCount() const { return pending_.size(); }
+
+    void beforeTick(NodeInterface& node) override {
+        // The root starts a new tick of the tree even when the previous one was cut short by a
+        // node that threw, whose afterTick never came.
+        if ((depth_ == 0) || (&node == root_)) {
+            root_ = &node;
+            depth_ = 0;
+            poll();
+        }
+        ++depth_;
+    }
+
+    void afterTick(NodeInterface& node, NodeResult result) override {
+        (void)node;
+        (void)result;
+        if ((depth_ > 0) && (--depth_ == 0)) {
+            flush();
+        }
+    }
+
+   private:
+    void parseResponses() {
+        remote_action::FrameHeader header;
+        try {
+            while (parser_.next(header, payload_)) {
+                if ((header.type != remote_action::kResponse) || (pending_.erase(header.request_id) == 0)) {
+                    continue;
+                }
+                const auto result = static_cast<NodeResult>(header.result);
+                responses_[header.request_id] =
+                    RemoteActionResponse{result == NodeResult::SUCCESS ? result : NodeResult::FAILURE, payload_};
+            }
+        } catch (const std::runtime_error&) {
+            disconnect();
+        }
+    }
+
+    /** @brief Closes the connection and fails the pending requests. */
+    void disconnect() {
+        if (fd_ == -1) {
+            return;
+        }
+        ::close(fd_);
+        fd_ = -1;
+        for (const uint32_t request_id : pending_) {
+            responses_[request_id] = RemoteActionResponse{NodeResult::FAILURE, ""};
+        }
+        pending_.clear();
+        output_.clear();
+        output_offset_ = 0;
+    }
+
+    int fd_ = -1;
+    uint32_t next_request_id_ = 1;
+    std::vector<uint8_t> output_;
+    size_t output_offset_ = 0;
+    remote_action::FrameParser parser_;
+    std::string payload_;
+    std::unordered_set<uint32_t> pending_;
+    std::unordered_map<uint32_t, RemoteActionResponse> responses_;
+    uint64_t write_count_ = 0;
+    uint32_t depth_ = 0;
+    // Node whose tick started the current tick of the tree.
+    const NodeInterface* root_ = nullptr;
+};
+
+}  // namespace behavior_tree
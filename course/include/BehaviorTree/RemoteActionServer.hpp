@@ -0,0 +1,260 @@
+/**
+ * @file RemoteActionServer.hpp
+ * @brief Local stand-in for the processes that run remote actions. It serves the protocol of
+ *        RemoteActionClient from a background thread and answers every request through a
+ *        handler, optionally after a delay. Meant for tests and examples.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// System libraries
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/RemoteAction.hpp"
+
+namespace behavior_tree {
+
+/** @brief Answer of the handler of a RemoteActionServer. */
+struct RemoteActionReply {
+    NodeResult result;
+    std::string output;
+    /** @brief Time before the response is sent. */
+    std::chrono::milliseconds delay{0};
+};
+
+class RemoteActionServer {
+   public:
+    /** @brief Called, from the thread of the server, for every request. */
+    using Handler = std::function<RemoteActionReply(const std::string& action, const std::string& arguments)>;
+
+    /**
+     * @brief Listens on the socket and starts serving.
+     *
+     * @param socket_path path of the socket, replaced if it exists.
+     * @param handler answers the requests.
+     */
+    RemoteActionServer(const std::string& socket_path, Handler handler)
+        : socket_path_{socket_path}, handler_{std::move(handler)} {
+        if (!handler_) {
+            throw std::invalid_argument("handler cannot be empty");
+        }
+        const sockaddr_un address = remote_action::makeAddress(socket_path_);
+        ::unlink(socket_path_.c_str());
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if ((listen_fd_ == -1) ||
+            (::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1) ||
+            (::listen(listen_fd_, 16) == -1) || (::pipe2(wake_fds_, O_CLOEXEC) == -1)) {
+            const std::string error = std::strerror(errno);
+            closeAll();
+            throw std::runtime_error("Cannot listen on " + socket_path_ + ": " + error);
+        }
+        thread_ = std::thread([this]() { serve(); });
+    }
+
+    RemoteActionServer(const RemoteActionServer&) = delete;
+    RemoteActionServer& operator=(const RemoteActionServer&) = delete;
+
+    /**
+     * @brief Stops serving, closes the connections and removes the socket.
+     */
+    ~RemoteActionServer() {
+        stop_.store(true);
+        wake();
+        thread_.join();
+        closeAll();
+        ::unlink(socket_path_.c_str());
+    }
+
+    /**
+     * @brief Closes every connection, as if the server crashed. New connections are accepted.
+     */
+    void disconnectClients() {
+        disconnect_.store(true);
+        wake();
+    }
+
+    /**
+     * @brief Returns the amount of requests received so far.
+     */
+    uint64_t getRequestCount() const { return request_count_.load(); }
+
+    /**
+     * @brief Returns the amount of reads that received requests, a client that batches
+     *        its requests needs fewer of them.
+     */
+    uint64_t getReadCount() const { return read_count_.load(); }
+
+   private:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    struct Connection {
+        int fd;
+        remote_action::FrameParser parser;
+    };
+
+    struct PendingReply {
+        int fd;
+        std::vector<uint8_t> frame;
+    };
+
+    void wake() {
+        const uint8_t byte = 1;
+        (void)::write(wake_fds_[1], &byte, 1);
+    }
+
+    void serve() {
+        std::vector<pollfd> fds;
+        while (!stop_.load()) {
+            if (disconnect_.exchange(false)) {
+                for (auto& connection : connections_) {
+                    ::close(connection.fd);
+                }
+                connections_.clear();
+                replies_.clear();
+            }
+            fds.clear();
+            fds.push_back(pollfd{wake_fds_[0], POLLIN, 0});
+            fds.push_back(pollfd{listen_fd_, POLLIN, 0});
+            for (const auto& connection : connections_) {
+                fds.push_back(pollfd{connection.fd, POLLIN, 0});
+            }
+            int timeout_ms = -1;
+            if (!replies_.empty()) {
+                const auto wait = replies_.begin()->first - std::chrono::steady_clock::now();
+                timeout_ms = static_cast<int>(
+                    std::max<int64_t>(0, std::chrono::ceil<std::chrono::milliseconds>(wait).count()));
+            }
+            if (::poll(fds.data(), fds.size(), timeout_ms) == -1) {
+                continue;
+            }
+            if ((fds[0].revents & POLLIN) != 0) {
+                uint8_t buffer[64];
+                (void)::read(wake_fds_[0], buffer, sizeof(buffer));
+            }
+            if ((fds[1].revents & POLLIN) != 0) {
+                const int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+                if (fd != -1) {
+                    connections_.push_back(Connection{fd, {}});
+                }
+            }
+            // Connections accepted in this iteration have no entry in fds.
+            for (size_t index = 2; index < fds.size(); ++index) {
+                if (fds[index].revents != 0) {
+                    receive(fds[index].fd);
+                }
+            }
+            sendDueReplies();
+        }
+    }
+
+    void receive(int fd) {
+        auto connection = std::find_if(connections_.begin(), connections_.end(),
+                                       [fd](const Connection& candidate) { return candidate.fd == fd; });
+        uint8_t chunk[4096];
+        const ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            drop(connection);
+            return;
+        }
+        ++read_count_;
+        connection->parser.append(chunk, static_cast<size_t>(received));
+        remote_action::FrameHeader header;
+        std::string payload;
+        try {
+            while (connection->parser.next(header, payload)) {
+                if (header.type != remote_action::kRequest) {
+                    continue;
+                }
+                ++request_count_;
+                const RemoteActionReply reply = handler_(payload.substr(0, header.action_length),
+                                                         payload.substr(header.action_length));
+                PendingReply pending{fd, {}};
+                remote_action::FrameHeader response{0, header.request_id, remote_action::kResponse,
+                                                    static_cast<uint8_t>(reply.result), 0};
+                remote_action::appendFrame(pending.frame, response, reply.output);
+                replies_.emplace(std::chrono::steady_clock::now() + reply.delay, std::move(pending));
+            }
+        } catch (const std::runtime_error&) {
+            drop(connection);
+        }
+    }
+
+    void sendDueReplies() {
+        const TimePoint now = std::chrono::steady_clock::now();
+        while (!replies_.empty() && (replies_.begin()->first <= now)) {
+            const PendingReply& reply = replies_.begin()->second;
+            size_t sent = 0;
+            while (sent < reply.frame.size()) {
+                const ssize_t written = ::send(reply.fd, reply.frame.data() + sent, reply.frame.size() - sent,
+                                               MSG_NOSIGNAL);
+                if (written <= 0) {
+                    break;
+                }
+                sent += static_cast<size_t>(written);
+            }
+            replies_.erase(replies_.begin());
+        }
+    }
+
+    void drop(std::vector<Connection>::iterator connection) {
+        const int fd = connection->fd;
+        ::close(fd);
+        connections_.erase(connection);
+        for (auto reply = replies_.begin(); reply != replies_.end();) {
+            reply = (reply->second.fd == fd) ? replies_.erase(reply) : std::next(reply);
+        }
+    }
+
+    void closeAll() {
+        for (auto& connection : connections_) {
+            ::close(connection.fd);
+        }
+        connections_.clear();
+        for (int* fd : {&listen_fd_, &wake_fds_[0], &wake_fds_[1]}) {
+            if (*fd != -1) {
+                ::close(*fd);
+                *fd = -1;
+            }
+        }
+    }
+
+    std::string socket_path_;
+    Handler handler_;
+    int listen_fd_ = -1;
+    int wake_fds_[2] = {-1, -1};
+    std::thread thread_;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> disconnect_{false};
+    std::atomic<uint64_t> request_count_{0};
+    std::atomic<uint64_t> read_count_{0};
+
+    // Only used by the thread of the server.
+    std::vector<Connection> connections_;
+    std::multimap<TimePoint, PendingReply> replies_;
+};
+
+}  // namespace behavior_tree
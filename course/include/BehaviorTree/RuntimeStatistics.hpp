@@ -0,0 +1,255 @@
+/**
+ * @file RuntimeStatistics.hpp
+ * @brief Runtime statistics of a BTManager that can be read from any thread.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TickObserver.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Tick observer that keeps the runtime statistics of a tree.
+ *        The ticking thread only updates atomic counters, so snapshot can be called
+ *        from any other thread without pausing the execution.
+ */
+class RuntimeStatistics : public TickObserver {
+   public:
+    /** @brief Ticks of a node. */
+    struct NodeHits {
+        std::string name;
+        uint64_t ticks;
+    };
+
+    /** @brief Statistics at a given point in time. */
+    struct Snapshot {
+        uint64_t total_ticks = 0;
+        double ticks_per_second = 0.0;
+        double latency_p50_ns = 0.0;
+        double latency_p90_ns = 0.0;
+        double latency_p99_ns = 0.0;
+        double latency_max_ns = 0.0;
+        uint64_t latency_sum_ns = 0;
+        uint64_t runs_success = 0;
+        uint64_t runs_failure = 0;
+        uint64_t runs_tick_limit = 0;
+        size_t blackboard_size = 0;
+        uint64_t blackboard_writes = 0;
+        double blackboard_writes_per_second = 0.0;
+        std::vector<NodeHits> node_hits;
+    };
+
+    /**
+     * @brief Construct a new RuntimeStatistics object
+     *
+     * @param blackboard blackboard whose size and writes are reported, it can be nullptr.
+     */
+    explicit RuntimeStatistics(std::shared_ptr<const Blackboard> blackboard) : blackboard_{std::move(blackboard)} {
+        for (auto& bucket : latency_buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        window_start_ = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Records the outcome of a call to BTManager::run.
+     *
+     * @param result result returned by run.
+     * @param tick_limit_reached true when run stopped because of max_tick_count.
+     */
+    void runFinished(NodeResult result, bool tick_limit_reached) {
+        if (tick_limit_reached) {
+            runs_tick_limit_.fetch_add(1, std::memory_order_relaxed);
+        } else if (result == NodeResult::SUCCESS) {
+            runs_success_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            runs_failure_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns the current statistics. It can be called from any thread.
+     *
+     * @return Snapshot statistics.
+     */
+    Snapshot snapshot() const {
+        Snapshot snapshot;
+        snapshot.total_ticks = total_ticks_.load(std::memory_order_relaxed);
+        snapshot.ticks_per_second = ticks_per_second_.load(std::memory_order_relaxed);
+        snapshot.runs_success = runs_success_.load(std::memory_order_relaxed);
+        snapshot.runs_failure = runs_failure_.load(std::memory_order_relaxed);
+        snapshot.runs_tick_limit = runs_tick_limit_.load(std::memory_order_relaxed);
+        if (blackboard_ != nullptr) {
+            snapshot.blackboard_size = blackboard_->getSize();
+            snapshot.blackboard_writes = blackboard_->getWriteCount();
+        }
+        snapshot.blackboard_writes_per_second = writes_per_second_.load(std::memory_order_relaxed);
+
+        std::array<uint64_t, kBucketCount> buckets;
+        uint64_t samples = 0;
+        for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            buckets[bucket] = latency_buckets_[bucket].load(std::memory_order_relaxed);
+            samples += buckets[bucket];
+        }
+        snapshot.latency_p50_ns = percentile(buckets, samples, 0.50);
+        snapshot.latency_p90_ns = percentile(buckets, samples, 0.90);
+        snapshot.latency_p99_ns = percentile(buckets, samples, 0.99);
+        snapshot.latency_max_ns = percentile(buckets, samples, 1.0);
+        snapshot.latency_sum_ns = latency_sum_ns_.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        snapshot.node_hits.reserve(nodes_.size());
+        for (const auto& node : nodes_) {
+            snapshot.node_hits.emplace_back(NodeHits{node.name, node.ticks.load(std::memory_order_relaxed)});
+        }
+        return snapshot;
+    }
+
+    void nodeAdded(NodeInterface& node) override {
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        while (nodes_.size() <= node.getId()) {
+            nodes_.emplace_back();
+        }
+        nodes_[node.getId()].name = node.getNameRef();
+    }
+
+    void beforeTick(NodeInterface& node) override {
+        nodes_[node.getId()].ticks.fetch_add(1, std::memory_order_relaxed);
+        // The first observed node of the stack is the root: a new tick of the tree. The root
+        // starts one also when a node threw during the previous tick, skipping the afterTick
+        // of its ancestors.
+        if ((depth_ == 0) || (&node == root_)) {
+            root_ = &node;
+            depth_ = 0;
+            tick_start_ = std::chrono::steady_clock::now();
+        }
+        ++depth_;
+    }
+
+    void afterTick(NodeInterface& node, NodeResult result) override {
+        (void)node;
+        (void)result;
+        if ((depth_ == 0) || (--depth_ != 0)) {
+            return;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        const uint64_t latency_ns =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - tick_start_).count());
+        latency_buckets_[bucketOf(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+        latency_sum_ns_.fetch_add(latency_ns, std::memory_order_relaxed);
+        const uint64_t total_ticks = total_ticks_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        // Rates are refreshed once per window.
+        const double window_s = std::chrono::duration<double>(now - window_start_).count();
+        if (window_s >= kRateWindowSeconds) {
+            const uint64_t writes = blackboard_ == nullptr ? 0 : blackboard_->getWriteCount();
+            ticks_per_second_.store((total_ticks - window_ticks_) / window_s, std::memory_order_relaxed);
+            writes_per_second_.store((writes - window_writes_) / window_s, std::memory_order_relaxed);
+            window_start_ = now;
+            window_ticks_ = total_ticks;
+            window_writes_ = writes;
+        }
+    }
+
+   private:
+    /** @brief Seconds between updates of the rates. */
+    static constexpr double kRateWindowSeconds = 1.0;
+    /** @brief Every power of two is split in kSubBuckets buckets. */
+    static constexpr size_t kSubBucketBits = 2;
+    static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+    static constexpr size_t kBucketCount = 64 * kSubBuckets;
+
+    /** @brief Logarithmic bucket of a latency, with a relative error below 1 / kSubBuckets. */
+    static size_t bucketOf(uint64_t value) {
+        if (value < kSubBuckets) {
+            return static_cast<size_t>(value);
+        }
+        const size_t width = 64 - static_cast<size_t>(__builtin_clzll(value));
+        const size_t shift = width - kSubBucketBits - 1;
+        const size_t sub_bucket = static_cast<size_t>(value >> shift) & (kSubBuckets - 1);
+        return (shift + 1) * kSubBuckets + sub_bucket;
+    }
+
+    /** @brief Upper bound of the values stored in a bucket. */
+    static double bucketUpperBound(size_t bucket) {
+        if (bucket < kSubBuckets) {
+            return static_cast<double>(bucket);
+        }
+        const size_t shift = bucket / kSubBuckets - 1;
+        const size_t sub_bucket = bucket % kSubBuckets;
+        return static_cast<double>(((kSubBuckets + sub_bucket + 1) << shift) - 1);
+    }
+
+    static double percentile(const std::array<uint64_t, kBucketCount>& buckets, uint64_t samples, double quantile) {
+        if (samples == 0) {
+            return 0.0;
+        }
+        const double target = quantile * static_cast<double>(samples);
+        uint64_t accumulated = 0;
+        size_t last_used = 0;
+        for (size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+            if (buckets[bucket] == 0) {
+                continue;
+            }
+            last_used = bucket;
+            accumulated += buckets[bucket];
+            if (static_cast<double>(accumulated) >= target) {
+                return bucketUpperBound(bucket);
+            }
+        }
+        return bucketUpperBound(last_used);
+    }
+
+    /** @brief Hits of a node, the name is only written while registering the node. */
+    struct NodeCounter {
+        std::string name;
+        std::atomic<uint64_t> ticks{0};
+    };
+
+    std::shared_ptr<const Blackboard> blackboard_;
+
+    // Written by the ticking thread, read by snapshot.
+    std::atomic<uint64_t> total_ticks_{0};
+    std::atomic<uint64_t> runs_success_{0};
+    std::atomic<uint64_t> runs_failure_{0};
+    std::atomic<uint64_t> runs_tick_limit_{0};
+    std::atomic<double> ticks_per_second_{0.0};
+    std::atomic<double> writes_per_second_{0.0};
+    std::array<std::atomic<uint64_t>, kBucketCount> latency_buckets_;
+    std::atomic<uint64_t> latency_sum_ns_{0};
+
+    // The deque keeps the counters in place while new nodes are registered.
+    mutable std::mutex nodes_mutex_;
+    std::deque<NodeCounter> nodes_;
+
+    // Only used by the ticking thread.
+    uint32_t depth_ = 0;
+    const NodeInterface* root_ = nullptr;
+    std::chrono::steady_clock::time_point tick_start_;
+    std::chrono::steady_clock::time_point window_start_;
+    uint64_t window_ticks_ = 0;
+    uint64_t window_writes_ = 0;
+};
+
+}  // namespace behavior_tree
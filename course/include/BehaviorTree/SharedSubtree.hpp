@@ -0,0 +1,241 @@
+/**
+ * @file SharedSubtree.hpp
+ * @brief Immutable structure of a subtree, shared by every SubtreeInstanceNode that uses it.
+ *        The structure is stored flat (one entry per node, children as ranges of indexes) and
+ *        keeps no execution state: the position of each sequence and fallback lives in a state
+ *        block of getStateSize() words owned by each instance.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+class SharedSubtree {
+   public:
+    /** @brief Index of a node within the structure. */
+    using Index = uint32_t;
+
+   private:
+    enum class Kind : uint8_t { LEAF, SEQUENCE, FALLBACK, NEGATION };
+
+    /** @brief Node of the structure. Leaves point to leaves_, the rest to a range of children_. */
+    struct Entry {
+        Kind kind;
+        uint32_t first;
+        uint32_t count;
+        uint32_t slot;
+    };
+
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+   public:
+    /**
+     * @brief Builds a SharedSubtree bottom-up: children are added before their parents and
+     *        every node but the root has exactly one parent.
+     */
+    class Builder {
+       public:
+        /**
+         * @brief Adds a leaf. The leaf is ticked by every instance of the subtree, so it
+         *        shouldn't keep per-instance state (e.g. conditions over a blackboard).
+         *
+         * @param leaf node to be ticked.
+         * @return Index index of the new node.
+         */
+        Index addLeaf(std::shared_ptr<NodeInterface> leaf) {
+            if (leaf == nullptr) {
+                throw std::invalid_argument("leaf cannot be nullptr");
+            }
+            leaves_.emplace_back(std::move(leaf));
+            return addEntry(Kind::LEAF, static_cast<uint32_t>(leaves_.size() - 1), 0, kNoSlot);
+        }
+
+        /**
+         * @brief Adds a node that behaves as SequenceNode.
+         *
+         * @param children indexes of the children, in order.
+         * @return Index index of the new node.
+         */
+        Index addSequence(const std::vector<Index>& children) { return addComposite(Kind::SEQUENCE, children); }
+
+        /**
+         * @brief Adds a node that behaves as FallbackNode.
+         *
+         * @param children indexes of the children, in order.
+         * @return Index index of the new node.
+         */
+        Index addFallback(const std::vector<Index>& children) { return addComposite(Kind::FALLBACK, children); }
+
+        /**
+         * @brief Adds a node that behaves as NegationNode.
+         *
+         * @param child index of the child.
+         * @return Index index of the new node.
+         */
+        Index addNegation(Index child) {
+            const auto first = static_cast<uint32_t>(children_.size());
+            adopt(child);
+            return addEntry(Kind::NEGATION, first, 1, kNoSlot);
+        }
+
+        /**
+         * @brief Builds the structure. The builder is left empty.
+         *
+         * @param root index of the root, it cannot have a parent.
+         * @return std::shared_ptr<const SharedSubtree> structure to be shared by the instances.
+         */
+        std::shared_ptr<const SharedSubtree> build(Index root) {
+            if ((root >= entries_.size()) || has_parent_[root]) {
+                throw std::invalid_argument("invalid root");
+            }
+            std::shared_ptr<const SharedSubtree> subtree(
+                new SharedSubtree(std::move(entries_), std::move(children_), std::move(leaves_), state_size_, root));
+            *this = Builder();
+            return subtree;
+        }
+
+       private:
+        Index addComposite(Kind kind, const std::vector<Index>& children) {
+            const auto first = static_cast<uint32_t>(children_.size());
+            for (const auto child : children) {
+                adopt(child);
+            }
+            return addEntry(kind, first, static_cast<uint32_t>(children.size()), state_size_++);
+        }
+
+        void adopt(Index child) {
+            if ((child >= entries_.size()) || has_parent_[child]) {
+                throw std::invalid_argument("child must be an existing node without parent");
+            }
+            has_parent_[child] = true;
+            children_.emplace_back(child);
+        }
+
+        Index addEntry(Kind kind, uint32_t first, uint32_t count, uint32_t slot) {
+            entries_.emplace_back(Entry{kind, first, count, slot});
+            has_parent_.emplace_back(false);
+            return static_cast<Index>(entries_.size() - 1);
+        }
+
+        std::vector<Entry> entries_;
+        std::vector<Index> children_;
+        std::vector<std::shared_ptr<NodeInterface>> leaves_;
+        std::vector<bool> has_parent_;
+        uint32_t state_size_ = 0;
+    };
+
+    /**
+     * @brief Returns the amount of words of state that each instance needs.
+     */
+    size_t getStateSize() const { return state_size_; }
+
+    /**
+     * @brief Returns the amount of nodes of the structure.
+     */
+    size_t getNodeCount() const { return entries_.size(); }
+
+    /**
+     * @brief Ticks the subtree using the state of one instance.
+     *
+     * @param state state block of the instance, getStateSize() words initialized to zero.
+     * @param mode tick mode of the sequences and fallbacks.
+     * @return NodeResult result of the root.
+     */
+    NodeResult tick(uint32_t* state, TickMode mode) const { return tickEntry(root_, state, mode); }
+
+   private:
+    SharedSubtree(std::vector<Entry> entries, std::vector<Index> children,
+                  std::vector<std::shared_ptr<NodeInterface>> leaves, uint32_t state_size, Index root)
+        : entries_{std::move(entries)},
+          children_{std::move(children)},
+          leaves_{std::move(leaves)},
+          state_size_{state_size},
+          root_{root} {}
+
+    NodeResult tickEntry(Index index, uint32_t* state, TickMode mode) const {
+        const Entry& entry = entries_[index];
+        switch (entry.kind) {
+            case Kind::LEAF:
+                return leaves_[entry.first]->observedTick();
+            case Kind::NEGATION: {
+                const NodeResult result = tickEntry(children_[entry.first], state, mode);
+                if (result == NodeResult::SUCCESS) {
+                    return NodeResult::FAILURE;
+                } else if (result == NodeResult::FAILURE) {
+                    return NodeResult::SUCCESS;
+                }
+                return result;
+            }
+            case Kind::SEQUENCE:
+                return tickSequence(entry, state[entry.slot], state, mode);
+            case Kind::FALLBACK:
+                return tickFallback(entry, state[entry.slot], state, mode);
+        }
+        return NodeResult::FAILURE;
+    }
+
+    // Same behavior as SequenceNode::tick, with the index of the child in the instance state.
+    NodeResult tickSequence(const Entry& entry, uint32_t& current, uint32_t* state, TickMode mode) const {
+        if (entry.count == 0) {
+            return NodeResult::SUCCESS;
+        }
+        do {
+            const NodeResult result = tickEntry(children_[entry.first + current], state, mode);
+            if (result == NodeResult::RUNNING) {
+                return result;
+            } else if (result == NodeResult::FAILURE) {
+                current = 0;
+                return NodeResult::RUNNING;
+            }
+            ++current;
+            if (current == entry.count) {
+                current = 0;
+                return NodeResult::SUCCESS;
+            }
+        } while (mode == TickMode::EAGER);
+        return NodeResult::RUNNING;
+    }
+
+    // Same behavior as FallbackNode::tick, with the index of the child in the instance state.
+    NodeResult tickFallback(const Entry& entry, uint32_t& current, uint32_t* state, TickMode mode) const {
+        if (entry.count == 0) {
+            return NodeResult::SUCCESS;
+        }
+        do {
+            const NodeResult result = tickEntry(children_[entry.first + current], state, mode);
+            if ((result == NodeResult::RUNNING) || (result == NodeResult::SUCCESS)) {
+                return result;
+            }
+            ++current;
+            if (current == entry.count) {
+                current = 0;
+                return NodeResult::FAILURE;
+            }
+        } while (mode == TickMode::EAGER);
+        return NodeResult::RUNNING;
+    }
+
+    const std::vector<Entry> entries_;
+    const std::vector<Index> children_;
+    const std::vector<std::shared_ptr<NodeInterface>> leaves_;
+    const uint32_t state_size_;
+    const Index root_;
+};
+
+}  // namespace behavior_tree
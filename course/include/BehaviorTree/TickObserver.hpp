@@ -0,0 +1,99 @@
+/**
+ * @file TickObserver.hpp
+ * @brief Interface to observe the ticks of the nodes managed by a BTManager.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <memory>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeUtils.hpp"
+
+namespace behavior_tree {
+
+class NodeInterface;
+
+/**
+ * @brief Receives a call before and after every tick of an observed node.
+ *        Nested nodes produce nested calls, so afterTick of a child always
+ *        happens between beforeTick and afterTick of its parent.
+ */
+class TickObserver {
+   public:
+    /** @brief Virtual destructor to ensure the proper destruction of derived clases */
+    virtual ~TickObserver() = default;
+
+    /**
+     * @brief Called once for every node that starts being observed.
+     *
+     * @param node node that will be observed.
+     */
+    virtual void nodeAdded(NodeInterface& node) { (void)node; }
+
+    /**
+     * @brief Called right before the node is ticked.
+     *
+     * @param node node to be ticked.
+     */
+    virtual void beforeTick(NodeInterface& node) { (void)node; }
+
+    /**
+     * @brief Called right after the node was ticked.
+     *
+     * @param node node that was ticked.
+     * @param result result of the tick.
+     */
+    virtual void afterTick(NodeInterface& node, NodeResult result) {
+        (void)node;
+        (void)result;
+    }
+};
+
+/**
+ * @brief Forwards every call to a list of observers, in the order they were added.
+ */
+class TickObserverChain : public TickObserver {
+   public:
+    /**
+     * @brief Appends an observer to the chain.
+     *
+     * @param observer observer to be added.
+     */
+    void add(std::shared_ptr<TickObserver> observer) { observers_.emplace_back(std::move(observer)); }
+
+    /**
+     * @brief Returns true when there are no observers in the chain.
+     */
+    bool empty() const { return observers_.empty(); }
+
+    void nodeAdded(NodeInterface& node) override {
+        for (auto& observer : observers_) {
+            observer->nodeAdded(node);
+        }
+    }
+
+    void beforeTick(NodeInterface& node) override {
+        for (auto& observer : observers_) {
+            observer->beforeTick(node);
+        }
+    }
+
+    void afterTick(NodeInterface& node, NodeResult result) override {
+        // Reverse order, so the observers wrap the tick like nested scopes.
+        for (auto observer = observers_.rbegin(); observer != observers_.rend(); ++observer) {
+            (*observer)->afterTick(node, result);
+        }
+    }
+
+   private:
+    std::vector<std::shared_ptr<TickObserver>> observers_;
+};
+
+}  // namespace behavior_tree
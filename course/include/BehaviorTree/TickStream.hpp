@@ -0,0 +1,349 @@
+/**
+ * @file TickStream.hpp
+ * @brief Stream of the results of every tick of every node through POSIX shared memory.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// System libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TickObserver.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Layout of the shared memory. Everything the readers look at while the
+ *        publisher writes is an atomic, so readers in other processes never race with it.
+ *          - Header.
+ *          - max_nodes names of kNameSize bytes, indexed by node id.
+ *          - capacity records, used as a ring buffer.
+ */
+namespace tick_stream {
+
+constexpr uint64_t kMagic = 0x4254535452454d31ull;  // "BTSTREM1"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kNameSize = 64;
+
+struct Header {
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    uint32_t capacity;
+    uint32_t max_nodes;
+    uint32_t reserved;
+    /** @brief Amount of records written so far. */
+    std::atomic<uint64_t> write_index;
+};
+
+struct Name {
+    /** @brief Length of the name, 0 until the name is written. */
+    std::atomic<uint32_t> length;
+    char text[kNameSize - sizeof(uint32_t)];
+};
+
+/**
+ * @brief A record is valid when its sequence is 2 * index + 2, where index is the position
+ *        in the stream. The sequence is odd while the record is being written.
+ */
+struct Record {
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> tick;
+    std::atomic<uint64_t> timestamp_ns;
+    /** @brief node id (32 bits) | result (8 bits) | depth (8 bits). */
+    std::atomic<uint64_t> payload;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory needs lock-free atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared memory needs lock-free atomics");
+
+inline size_t mappingSize(uint32_t capacity, uint32_t max_nodes) {
+    return sizeof(Header) + sizeof(Name) * max_nodes + sizeof(Record) * capacity;
+}
+
+}  // namespace tick_stream
+
+/** @brief Result of a tick of a node, as read from the stream. */
+struct TickRecord {
+    uint64_t index;
+    uint64_t tick;
+    uint64_t timestamp_ns;
+    uint32_t node_id;
+    NodeResult result;
+    uint8_t depth;
+};
+
+/**
+ * @brief Tick observer that writes the result of every tick of every node into a ring
+ *        buffer in POSIX shared memory. It never waits for the readers: a reader that
+ *        falls behind by more than the capacity loses the oldest records.
+ */
+class TickStreamPublisher : public TickObserver {
+   public:
+    /**
+     * @brief Creates (or replaces) the shared memory object.
+     *
+     * @param name name of the shared memory object, e.g. "/bt_tick_stream".
+     * @param capacity records kept in the ring buffer, rounded up to a power of two.
+     * @param max_nodes nodes whose names are published, the ids above it have no name.
+     */
+    explicit TickStreamPublisher(const std::string& name, uint32_t capacity = 1u << 16, uint32_t max_nodes = 4096)
+        : name_{name} {
+        if (capacity == 0) {
+            throw std::invalid_argument("capacity cannot be 0");
+        }
+        uint32_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        capacity_ = rounded;
+        max_nodes_ = max_nodes;
+        size_ = tick_stream::mappingSize(capacity_, max_nodes_);
+
+        ::shm_unlink(name_.c_str());
+        const int fd = ::shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd == -1) {
+            throw std::runtime_error("Cannot create shared memory " + name_ + ": " + std::strerror(errno));
+        }
+        if (::ftruncate(fd, static_cast<off_t>(size_)) == -1) {
+            const std::string error = std::strerror(errno);
+            ::close(fd);
+            ::shm_unlink(name_.c_str());
+            throw std::runtime_error("Cannot size shared memory " + name_ + ": " + error);
+        }
+        void* mapping = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            ::shm_unlink(name_.c_str());
+            throw std::runtime_error("Cannot map shared memory " + name_ + ": " + std::strerror(errno));
+        }
+        mapping_ = static_cast<uint8_t*>(mapping);
+
+        // ftruncate zero-fills, which is a valid initial state for every atomic.
+        header_ = reinterpret_cast<tick_stream::Header*>(mapping_);
+        names_ = reinterpret_cast<tick_stream::Name*>(mapping_ + sizeof(tick_stream::Header));
+        records_ = reinterpret_cast<tick_stream::Record*>(mapping_ + sizeof(tick_stream::Header) +
+                                                          sizeof(tick_stream::Name) * max_nodes_);
+        header_->version = tick_stream::kVersion;
+        header_->capacity = capacity_;
+        header_->max_nodes = max_nodes_;
+        // Readers check the magic last, so it is published after the rest of the header.
+        header_->magic.store(tick_stream::kMagic, std::memory_order_release);
+    }
+
+    TickStreamPublisher(const TickStreamPublisher&) = delete;
+    TickStreamPublisher& operator=(const TickStreamPublisher&) = delete;
+
+    /**
+     * @brief Unmaps and removes the shared memory object. Attached readers keep their mapping.
+     */
+    ~TickStreamPublisher() {
+        ::munmap(mapping_, size_);
+        ::shm_unlink(name_.c_str());
+    }
+
+    /**
+     * @brief Returns the amount of records written so far.
+     */
+    uint64_t getWriteIndex() const { return write_index_; }
+
+    void nodeAdded(NodeInterface& node) override {
+        if (node.getId() >= max_nodes_) {
+            return;
+        }
+        tick_stream::Name& name = names_[node.getId()];
+        const size_t length = std::min(node.getNameRef().size(), sizeof(name.text));
+        std::memcpy(name.text, node.getNameRef().data(), length);
+        name.length.store(static_cast<uint32_t>(length), std::memory_order_release);
+    }
+
+    void beforeTick(NodeInterface& node) override {
+        // The root starts a new tick also when a node threw during the previous one, skipping
+        // the afterTick of its ancestors.
+        if ((depth_ == 0) || (&node == root_)) {
+            root_ = &node;
+            depth_ = 0;
+            ++tick_;
+        }
+        ++depth_;
+    }
+
+    void afterTick(NodeInterface& node, NodeResult result) override {
+        if (depth_ > 0) {
+            --depth_;
+        }
+        const uint64_t index = write_index_++;
+        tick_stream::Record& record = records_[index & (capacity_ - 1)];
+        const uint64_t timestamp_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+
+        // Seqlock: odd sequence while writing, so readers can discard torn records.
+        record.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        record.tick.store(tick_, std::memory_order_relaxed);
+        record.timestamp_ns.store(timestamp_ns, std::memory_order_relaxed);
+        record.payload.store(static_cast<uint64_t>(node.getId()) | (static_cast<uint64_t>(result) << 32) |
+                                 (static_cast<uint64_t>(std::min<uint32_t>(depth_, 255)) << 40),
+                             std::memory_order_relaxed);
+        record.sequence.store(2 * index + 2, std::memory_order_release);
+        header_->write_index.store(index + 1, std::memory_order_release);
+    }
+
+   private:
+    std::string name_;
+    uint32_t capacity_;
+    uint32_t max_nodes_;
+    size_t size_;
+    uint8_t* mapping_;
+    tick_stream::Header* header_;
+    tick_stream::Name* names_;
+    tick_stream::Record* records_;
+
+    // Only used by the ticking thread.
+    uint64_t write_index_ = 0;
+    uint64_t tick_ = 0;
+    uint32_t depth_ = 0;
+    const NodeInterface* root_ = nullptr;
+};
+
+/**
+ * @brief Attaches to the stream of a TickStreamPublisher, usually from another process,
+ *        and reads the records in order. It maps the memory read-only and never writes to it.
+ */
+class TickStreamReader {
+   public:
+    /**
+     * @brief Attaches to the stream.
+     *
+     * @param name name of the shared memory object.
+     * @param from_start when false, only the records written after attaching are read.
+     */
+    explicit TickStreamReader(const std::string& name, bool from_start = false) {
+        const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd == -1) {
+            throw std::runtime_error("Cannot open shared memory " + name + ": " + std::strerror(errno));
+        }
+        struct stat status;
+        if ((::fstat(fd, &status) == -1) || (static_cast<size_t>(status.st_size) < sizeof(tick_stream::Header))) {
+            ::close(fd);
+            throw std::runtime_error("Shared memory " + name + " is not a tick stream");
+        }
+        size_ = static_cast<size_t>(status.st_size);
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Cannot map shared memory " + name + ": " + std::strerror(errno));
+        }
+        mapping_ = static_cast<const uint8_t*>(mapping);
+        header_ = reinterpret_cast<const tick_stream::Header*>(mapping_);
+        if ((header_->magic.load(std::memory_order_acquire) != tick_stream::kMagic) ||
+            (header_->version != tick_stream::kVersion) ||
+            (tick_stream::mappingSize(header_->capacity, header_->max_nodes) > size_)) {
+            ::munmap(const_cast<uint8_t*>(mapping_), size_);
+            throw std::runtime_error("Shared memory " + name + " is not a compatible tick stream");
+        }
+        capacity_ = header_->capacity;
+        max_nodes_ = header_->max_nodes;
+        names_ = reinterpret_cast<const tick_stream::Name*>(mapping_ + sizeof(tick_stream::Header));
+        records_ = reinterpret_cast<const tick_stream::Record*>(mapping_ + sizeof(tick_stream::Header) +
+                                                                sizeof(tick_stream::Name) * max_nodes_);
+        next_index_ = from_start ? 0 : header_->write_index.load(std::memory_order_acquire);
+    }
+
+    TickStreamReader(const TickStreamReader&) = delete;
+    TickStreamReader& operator=(const TickStreamReader&) = delete;
+
+    ~TickStreamReader() { ::munmap(const_cast<uint8_t*>(mapping_), size_); }
+
+    /**
+     * @brief Appends the records written since the last call.
+     *
+     * @param records output where the records are appended.
+     * @param max_records maximum amount of records to append.
+     * @return size_t amount of records appended.
+     */
+    size_t poll(std::vector<TickRecord>& records, size_t max_records = SIZE_MAX) {
+        const uint64_t write_index = header_->write_index.load(std::memory_order_acquire);
+        if (write_index - next_index_ > capacity_) {
+            lost_ += write_index - capacity_ - next_index_;
+            next_index_ = write_index - capacity_;
+        }
+        size_t appended = 0;
+        while ((next_index_ < write_index) && (appended < max_records)) {
+            const uint64_t index = next_index_++;
+            const tick_stream::Record& slot = records_[index & (capacity_ - 1)];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            TickRecord record;
+            record.index = index;
+            record.tick = slot.tick.load(std::memory_order_relaxed);
+            record.timestamp_ns = slot.timestamp_ns.load(std::memory_order_relaxed);
+            const uint64_t payload = slot.payload.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Overwritten while (or before) reading it.
+            if ((sequence != 2 * index + 2) || (slot.sequence.load(std::memory_order_relaxed) != sequence)) {
+                ++lost_;
+                continue;
+            }
+            record.node_id = static_cast<uint32_t>(payload);
+            record.result = static_cast<NodeResult>((payload >> 32) & 0xff);
+            record.depth = static_cast<uint8_t>((payload >> 40) & 0xff);
+            records.emplace_back(record);
+            ++appended;
+        }
+        return appended;
+    }
+
+    /**
+     * @brief Returns the amount of records overwritten before they could be read.
+     */
+    uint64_t getLostRecords() const { return lost_; }
+
+    /**
+     * @brief Returns the name of a node, empty when it is unknown.
+     *
+     * @param node_id id of the node.
+     */
+    std::string getNodeName(uint32_t node_id) const {
+        if (node_id >= max_nodes_) {
+            return "";
+        }
+        const tick_stream::Name& name = names_[node_id];
+        const uint32_t length = name.length.load(std::memory_order_acquire);
+        return std::string(name.text, std::min<size_t>(length, sizeof(name.text)));
+    }
+
+   private:
+    size_t size_;
+    const uint8_t* mapping_;
+    const tick_stream::Header* header_;
+    const tick_stream::Name* names_;
+    const tick_stream::Record* records_;
+    uint32_t capacity_;
+    uint32_t max_nodes_;
+    uint64_t next_index_;
+    uint64_t lost_ = 0;
+};
+
+}  // namespace behavior_tree
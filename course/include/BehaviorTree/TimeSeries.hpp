@@ -0,0 +1,332 @@
+/**
+ * @file TimeSeries.hpp
+ * @brief Fixed-capacity history of timestamped samples. One writer thread appends without
+ *        locks and any amount of readers query the latest samples, time windows or
+ *        aggregates while it writes, reading the samples in place.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+// Challenge includes
+#include "BehaviorTree/Clock.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Aggregates of a range of samples.
+ */
+struct TimeSeriesSummary {
+    size_t count = 0;
+    double sum = 0.0;
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+};
+
+template <typename T>
+class TimeSeries {
+    static_assert(std::is_trivially_copyable<T>::value, "samples are copied while they may be overwritten");
+    static_assert(std::is_default_constructible<T>::value, "samples are read into default constructed values");
+
+   public:
+    using TimePoint = Clock::TimePoint;
+
+    struct Sample {
+        TimePoint timestamp;
+        T value;
+    };
+
+    /**
+     * @brief Construct a new TimeSeries object
+     *
+     * @param capacity amount of samples kept, older ones are overwritten.
+     */
+    explicit TimeSeries(size_t capacity) : capacity_{capacity} {
+        if (capacity_ == 0) {
+            throw std::invalid_argument("capacity must be greater than 0");
+        }
+        samples_ = std::make_unique<Sample[]>(capacity_);
+    }
+
+    TimeSeries(const TimeSeries&) = delete;
+    TimeSeries& operator=(const TimeSeries&) = delete;
+
+    /**
+     * @brief Appends a sample, overwriting the oldest one when it is full. Only one thread
+     *        may append.
+     *
+     * @param value value of the sample.
+     * @param timestamp time of the sample, not older than the previous one.
+     */
+    void append(const T& value, TimePoint timestamp) {
+        const uint64_t index = head_.load(std::memory_order_relaxed);
+        if ((index > 0) && (timestamp < last_timestamp_)) {
+            throw std::invalid_argument("samples must be appended in time order");
+        }
+        // Readers drop what they copied from a slot once its next sample is claimed.
+        claimed_.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        samples_[index % capacity_] = Sample{timestamp, value};
+        head_.store(index + 1, std::memory_order_release);
+        last_timestamp_ = timestamp;
+    }
+
+    /**
+     * @brief Returns the maximum amount of samples kept.
+     */
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief Returns the amount of samples kept.
+     */
+    size_t size() const { return static_cast<size_t>(std::min<uint64_t>(getAppendCount(), capacity_)); }
+
+    /**
+     * @brief Returns the amount of samples appended so far.
+     */
+    uint64_t getAppendCount() const { return head_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Reads the newest sample.
+     *
+     * @param sample output.
+     * @return true when there is one.
+     */
+    bool latest(Sample& sample) const {
+        // Retried in case the writer wraps around the whole buffer meanwhile.
+        for (;;) {
+            const uint64_t head = getAppendCount();
+            if (head == 0) {
+                return false;
+            }
+            if (read(head - 1, sample)) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Copies the newest samples, oldest first, into a buffer of the caller.
+     *
+     * @param count maximum amount of samples.
+     * @param samples output, room for count samples.
+     * @return size_t amount of samples copied.
+     */
+    size_t latest(size_t count, Sample* samples) const {
+        size_t copied = 0;
+        visitLatest(count, [&](const Sample& sample) { samples[copied++] = sample; });
+        return copied;
+    }
+
+    /**
+     * @brief Calls visitor(const Sample&) with the newest samples, oldest first. Samples
+     *        overwritten by the writer during the visit are skipped.
+     *
+     * @param count maximum amount of samples.
+     * @return size_t amount of samples visited.
+     */
+    template <typename Visitor>
+    size_t visitLatest(size_t count, Visitor&& visitor) const {
+        const uint64_t head = getAppendCount();
+        return visitRange(head - std::min<uint64_t>({count, capacity_, head}), head, TimePoint::max(), visitor);
+    }
+
+    /**
+     * @brief Calls visitor(const Sample&) with the samples in [from, to], oldest first.
+     *        It only reads the samples of the window and the one before it.
+     *
+     * @param from start of the window.
+     * @param to end of the window.
+     * @return size_t amount of samples visited.
+     */
+    template <typename Visitor>
+    size_t visitWindow(TimePoint from, TimePoint to, Visitor&& visitor) const {
+        const uint64_t head = getAppendCount();
+        return visitRange(findFirst(from, head), head, to, visitor);
+    }
+
+    /**
+     * @brief Aggregates the newest samples. Only for arithmetic values.
+     *
+     * @param count maximum amount of samples.
+     */
+    TimeSeriesSummary summarizeLatest(size_t count) const {
+        const uint64_t head = getAppendCount();
+        return summarizeRange(head - std::min<uint64_t>({count, capacity_, head}), head, TimePoint::max());
+    }
+
+    /**
+     * @brief Aggregates the samples in [from, to]. Only for arithmetic values.
+     *
+     * @param from start of the window.
+     * @param to end of the window.
+     */
+    TimeSeriesSummary summarizeWindow(TimePoint from, TimePoint to) const {
+        const uint64_t head = getAppendCount();
+        return summarizeRange(findFirst(from, head), head, to);
+    }
+
+   private:
+    /** @brief Samples read per validation. */
+    static constexpr size_t kChunkSize = 32;
+
+    /**
+     * @brief Copies the sample with the given index out of its slot.
+     * @return false when it was overwritten before or during the copy.
+     */
+    bool read(uint64_t index, Sample& sample) const {
+        std::memcpy(&sample, &samples_[index % capacity_], sizeof(Sample));
+        return overwrittenIn(index, 1) == 0;
+    }
+
+    /**
+     * @brief Returns how many of the samples [first, first + count), read before calling it,
+     *        may have been overwritten during the read. Slots are overwritten in order, so
+     *        they are the first ones.
+     */
+    size_t overwrittenIn(uint64_t first, size_t count) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t claimed = claimed_.load(std::memory_order_relaxed);
+        // The slot of a sample is overwritten by the sample index + capacity.
+        const uint64_t lowest = (claimed > capacity_) ? claimed - capacity_ : 0;
+        return (lowest > first) ? static_cast<size_t>(std::min<uint64_t>(lowest - first, count)) : 0;
+    }
+
+    /** @brief Returns the index of the first published sample not older than from. */
+    uint64_t findFirst(TimePoint from, uint64_t head) const {
+        const uint64_t oldest = head - std::min<uint64_t>(capacity_, head);
+        // Walks back from the newest sample, so only the window is read.
+        uint64_t first = head;
+        Sample sample;
+        while (first > oldest) {
+            if (read(first - 1, sample) && (sample.timestamp < from)) {
+                break;
+            }
+            --first;
+        }
+        return first;
+    }
+
+    /** @brief Position of the slot of a sample, given the slot of the first one of its chunk. */
+    size_t slotOf(size_t position, size_t offset) const {
+        // Chunks are never bigger than the capacity.
+        const size_t slot = position + offset;
+        return (slot >= capacity_) ? slot - capacity_ : slot;
+    }
+
+    /**
+     * @brief Visits the published samples in [first, last) up to the timestamp to. Chunks
+     *        of samples are copied and then validated at once, before being visited.
+     */
+    template <typename Visitor>
+    size_t visitRange(uint64_t first, uint64_t last, TimePoint to, Visitor& visitor) const {
+        size_t visited = 0;
+        Sample chunk[kChunkSize];
+        size_t position = static_cast<size_t>(first % capacity_);
+        for (uint64_t start = first; start < last; start += kChunkSize) {
+            const size_t count = static_cast<size_t>(std::min<uint64_t>(kChunkSize, last - start));
+            const size_t contiguous = std::min(count, capacity_ - position);
+            std::memcpy(chunk, &samples_[position], contiguous * sizeof(Sample));
+            std::memcpy(chunk + contiguous, &samples_[0], (count - contiguous) * sizeof(Sample));
+            position = slotOf(position, count);
+            for (size_t offset = overwrittenIn(start, count); offset < count; ++offset) {
+                if (chunk[offset].timestamp > to) {
+                    return visited;
+                }
+                visitor(static_cast<const Sample&>(chunk[offset]));
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+    /**
+     * @brief Aggregates the published samples in [first, last) up to the timestamp to. The
+     *        samples are aggregated in place, without copying them, and every chunk is then
+     *        validated: when the writer overwrote part of it, the rest is aggregated again.
+     */
+    TimeSeriesSummary summarizeRange(uint64_t first, uint64_t last, TimePoint to) const {
+        TimeSeriesSummary summary = start();
+        size_t position = static_cast<size_t>(first % capacity_);
+        for (uint64_t begin = first; begin < last; begin += kChunkSize) {
+            const size_t count = static_cast<size_t>(std::min<uint64_t>(kChunkSize, last - begin));
+            TimeSeriesSummary chunk;
+            bool reached_to;
+            size_t skipped = 0;
+            for (;;) {
+                chunk = start();
+                reached_to = false;
+                for (size_t offset = skipped; offset < count; ++offset) {
+                    const Sample& sample = samples_[slotOf(position, offset)];
+                    if (sample.timestamp > to) {
+                        reached_to = true;
+                        break;
+                    }
+                    accumulate(chunk, sample.value);
+                }
+                const size_t overwritten = overwrittenIn(begin, count);
+                if (overwritten <= skipped) {
+                    break;
+                }
+                skipped = overwritten;
+            }
+            summary.count += chunk.count;
+            summary.sum += chunk.sum;
+            summary.min = std::min(summary.min, chunk.min);
+            summary.max = std::max(summary.max, chunk.max);
+            if (reached_to) {
+                break;
+            }
+            position = slotOf(position, count);
+        }
+        return finish(summary);
+    }
+
+    static void accumulate(TimeSeriesSummary& summary, const T& value) {
+        static_assert(std::is_arithmetic<T>::value, "aggregates need arithmetic values");
+        const double number = static_cast<double>(value);
+        summary.min = std::min(summary.min, number);
+        summary.max = std::max(summary.max, number);
+        summary.sum += number;
+        ++summary.count;
+    }
+
+    static TimeSeriesSummary start() {
+        TimeSeriesSummary summary;
+        summary.min = std::numeric_limits<double>::infinity();
+        summary.max = -std::numeric_limits<double>::infinity();
+        return summary;
+    }
+
+    static TimeSeriesSummary finish(TimeSeriesSummary summary) {
+        if (summary.count == 0) {
+            return TimeSeriesSummary{};
+        }
+        summary.mean = summary.sum / static_cast<double>(summary.count);
+        return summary;
+    }
+
+    size_t capacity_;
+    std::unique_ptr<Sample[]> samples_;
+    // Read by every reader, kept away from the data of the writer.
+    alignas(64) std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> claimed_{0};
+    TimePoint last_timestamp_{};
+};
+
+}  // namespace behavior_tree
@@ -0,0 +1,71 @@
+/**
+ * @file TreeDescription.hpp
+ * @brief Data-only description of a tree, used to build it through a NodeFactory.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace behavior_tree {
+
+/**
+ * @brief Description of a node and, recursively, of its children.
+ *        - kind: name of the factory that builds the node (e.g. "Sequence").
+ *        - name: name of the node, unique within the tree.
+ *        - parameters: free-form parameters read by the factory.
+ */
+struct NodeDescription {
+    std::string kind;
+    std::string name;
+    std::map<std::string, std::string> parameters;
+    std::vector<NodeDescription> children;
+
+    bool operator==(const NodeDescription& other) const {
+        return (kind == other.kind) && (name == other.name) && (parameters == other.parameters) &&
+               (children == other.children);
+    }
+
+    bool operator!=(const NodeDescription& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Returns a hash of the whole subtree. Equal subtrees have equal hashes.
+ *
+ * @param description root of the subtree.
+ * @return uint64_t hash of the subtree.
+ */
+inline uint64_t structuralHash(const NodeDescription& description) {
+    // FNV-1a over the fields, with the hashes of the children mixed in order.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const auto mix_bytes = [&hash](const std::string& bytes) {
+        for (const char byte : bytes) {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 0x100000001b3ull;
+        }
+        // Separator, so ("ab", "c") and ("a", "bc") differ.
+        hash ^= 0xff;
+        hash *= 0x100000001b3ull;
+    };
+    mix_bytes(description.kind);
+    mix_bytes(description.name);
+    for (const auto& parameter : description.parameters) {
+        mix_bytes(parameter.first);
+        mix_bytes(parameter.second);
+    }
+    for (const auto& child : description.children) {
+        hash ^= structuralHash(child);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+}  // namespace behavior_tree
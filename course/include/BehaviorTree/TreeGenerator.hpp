@@ -0,0 +1,187 @@
+/**
+ * @file TreeGenerator.hpp
+ * @brief Generates random but reproducible trees of any size.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Leaf whose results follow a given distribution. The results come from its
+ *        own pseudo-random sequence, so a given seed always produces the same results.
+ */
+class RandomLeafNode : public NodeInterface {
+   public:
+    /**
+     * @brief Construct a new RandomLeafNode object
+     *
+     * @param name name of the node.
+     * @param seed seed of the sequence of results.
+     * @param success_probability probability of returning SUCCESS.
+     * @param failure_probability probability of returning FAILURE, RUNNING takes the rest.
+     */
+    RandomLeafNode(const std::string& name, uint64_t seed, double success_probability, double failure_probability)
+        : NodeInterface(name),
+          state_{seed == 0 ? 0x9E3779B97F4A7C15ull : seed},
+          success_threshold_{toThreshold(success_probability)},
+          failure_threshold_{toThreshold(success_probability + failure_probability)} {}
+
+    NodeResult tick() override {
+        // xorshift64*, cheap enough not to hide the cost of the tree itself.
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        const uint32_t value = static_cast<uint32_t>((state_ * 0x2545F4914F6CDD1Dull) >> 32);
+        if (value < success_threshold_) {
+            return NodeResult::SUCCESS;
+        } else if (value < failure_threshold_) {
+            return NodeResult::FAILURE;
+        }
+        return NodeResult::RUNNING;
+    }
+
+   private:
+    static uint64_t toThreshold(double probability) {
+        if (probability <= 0.0) {
+            return 0;
+        }
+        if (probability >= 1.0) {
+            return uint64_t{1} << 32;
+        }
+        return static_cast<uint64_t>(probability * 4294967296.0);
+    }
+
+    uint64_t state_;
+    uint64_t success_threshold_;
+    uint64_t failure_threshold_;
+};
+
+/**
+ * @brief Shape of the generated trees.
+ *          - Composite nodes are picked with a probability proportional to their weight.
+ *          - Leaves are placed at depth `depth`, or earlier when max_nodes is reached.
+ */
+struct TreeGeneratorConfig {
+    uint64_t seed = 1;
+    uint32_t depth = 4;
+    uint32_t min_fanout = 2;
+    uint32_t max_fanout = 4;
+    double sequence_weight = 1.0;
+    double fallback_weight = 1.0;
+    double negation_weight = 0.2;
+    double leaf_success_probability = 0.6;
+    double leaf_failure_probability = 0.2;
+    /** @brief Only leaves are created after this amount of nodes, 0 means no limit. The parents
+     *         still pending and their remaining leaves are created on top of it. */
+    size_t max_nodes = 0;
+    std::string name_prefix = "node_";
+};
+
+/** @brief Amount of nodes generated of each kind. */
+struct GeneratedTreeInfo {
+    size_t nodes = 0;
+    size_t leaves = 0;
+    size_t sequences = 0;
+    size_t fallbacks = 0;
+    size_t negations = 0;
+    std::shared_ptr<NodeInterface> root;
+};
+
+/**
+ * @brief Generates trees into a BTManager. The root is the last node created, so it
+ *        becomes the root of the manager.
+ */
+class TreeGenerator {
+   public:
+    /**
+     * @brief Construct a new TreeGenerator object
+     *
+     * @param config shape of the trees.
+     */
+    explicit TreeGenerator(const TreeGeneratorConfig& config) : config_{config} {
+        if ((config_.min_fanout == 0) || (config_.min_fanout > config_.max_fanout)) {
+            throw std::invalid_argument("invalid fanout range");
+        }
+        if ((config_.sequence_weight < 0.0) || (config_.fallback_weight < 0.0) || (config_.negation_weight < 0.0) ||
+            (config_.sequence_weight + config_.fallback_weight + config_.negation_weight <= 0.0)) {
+            throw std::invalid_argument("invalid node kind weights");
+        }
+    }
+
+    /**
+     * @brief Generates a tree into the manager.
+     *
+     * @param manager manager where the nodes are created.
+     * @return GeneratedTreeInfo amount of nodes generated.
+     */
+    GeneratedTreeInfo generate(BTManager& manager) const {
+        GeneratedTreeInfo info;
+        std::mt19937_64 random(config_.seed);
+        info.root = generate(manager, random, config_.depth, info);
+        return info;
+    }
+
+   private:
+    enum class Kind { SEQUENCE, FALLBACK, NEGATION };
+
+    std::shared_ptr<NodeInterface> generate(BTManager& manager, std::mt19937_64& random, uint32_t depth,
+                                            GeneratedTreeInfo& info) const {
+        const bool limit_reached = (config_.max_nodes != 0) && (info.nodes + 1 >= config_.max_nodes);
+        if ((depth == 0) || limit_reached) {
+            ++info.leaves;
+            return manager.makeNode<RandomLeafNode>(nextName(info), random(), config_.leaf_success_probability,
+                                                    config_.leaf_failure_probability);
+        }
+
+        std::discrete_distribution<int> kinds{config_.sequence_weight, config_.fallback_weight,
+                                              config_.negation_weight};
+        const Kind kind = static_cast<Kind>(kinds(random));
+        if (kind == Kind::NEGATION) {
+            auto child = generate(manager, random, depth - 1, info);
+            ++info.negations;
+            return manager.makeNode<NegationNode>(nextName(info), child);
+        }
+
+        std::uniform_int_distribution<uint32_t> fanouts{config_.min_fanout, config_.max_fanout};
+        const uint32_t fanout = fanouts(random);
+        std::vector<std::shared_ptr<NodeInterface>> children;
+        children.reserve(fanout);
+        for (uint32_t child = 0; child < fanout; ++child) {
+            children.emplace_back(generate(manager, random, depth - 1, info));
+        }
+        if (kind == Kind::SEQUENCE) {
+            ++info.sequences;
+            return manager.makeNode<SequenceNode>(nextName(info), children);
+        }
+        ++info.fallbacks;
+        return manager.makeNode<FallbackNode>(nextName(info), children);
+    }
+
+    std::string nextName(GeneratedTreeInfo& info) const { return config_.name_prefix + std::to_string(info.nodes++); }
+
+    TreeGeneratorConfig config_;
+};
+
+}  // namespace behavior_tree
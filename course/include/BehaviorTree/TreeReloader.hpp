@@ -0,0 +1,188 @@
+/**
+ * @file TreeReloader.hpp
+ * @brief Replaces the tree of a BTManager from a new description, reusing the
+ *        unchanged subtrees with their state.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// Standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeFactory.hpp"
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/TreeDescription.hpp"
+
+namespace behavior_tree {
+
+/**
+ * @brief Builds trees from their description and stages them into a BTManager.
+ *        Every subtree whose description didn't change since the last tree built
+ *        reuses the node instances of that tree, so they keep their running state.
+ *        The manager swaps the new tree in between two ticks (see BTManager::stageTree).
+ */
+class TreeReloader {
+   public:
+    /** @brief Amount of nodes reused and created by a reload. */
+    struct ReloadReport {
+        size_t reused_nodes = 0;
+        size_t created_nodes = 0;
+    };
+
+    /**
+     * @brief Construct a new TreeReloader object
+     *
+     * @param manager manager whose tree is replaced, it must outlive the reloader.
+     * @param factory factory used to build the new nodes.
+     */
+    TreeReloader(BTManager& manager, NodeFactory factory) : manager_{manager}, factory_{std::move(factory)} {}
+
+    /**
+     * @brief Waits for the reload in progress, if any.
+     */
+    ~TreeReloader() {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+    }
+
+    TreeReloader(const TreeReloader&) = delete;
+    TreeReloader& operator=(const TreeReloader&) = delete;
+
+    /**
+     * @brief Builds the tree and stages it, on the calling thread.
+     *
+     * @param description description of the new tree.
+     * @return ReloadReport amount of nodes reused and created.
+     */
+    ReloadReport load(NodeDescription description) {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+        return buildAndStage(std::move(description));
+    }
+
+    /**
+     * @brief Builds the tree and stages it on a background thread. A reload still in
+     *        progress is waited for first. Errors (e.g. unknown kinds or duplicated
+     *        names) are reported through the future and leave the current tree untouched.
+     *
+     * @param description description of the new tree.
+     * @return std::shared_future<ReloadReport> amount of nodes reused and created.
+     */
+    std::shared_future<ReloadReport> reloadAsync(NodeDescription description) {
+        if (pending_.valid()) {
+            pending_.wait();
+        }
+        pending_ = std::async(std::launch::async, [this, description = std::move(description)]() mutable {
+                       return buildAndStage(std::move(description));
+                   }).share();
+        return pending_;
+    }
+
+   private:
+    /** @brief A node of the last tree built, with the description it was built from. */
+    struct IndexEntry {
+        const NodeDescription* description;
+        std::shared_ptr<NodeInterface> node;
+    };
+    using Index = std::unordered_multimap<uint64_t, IndexEntry>;
+
+    /** @brief Last tree built: its description owns the memory the index points to. */
+    struct BuiltTree {
+        NodeDescription description;
+        Index index;
+    };
+
+    ReloadReport buildAndStage(NodeDescription description) {
+        std::lock_guard<std::mutex> lock(build_mutex_);
+        auto tree = std::make_unique<BuiltTree>();
+        tree->description = std::move(description);
+
+        ReloadReport report;
+        BTManager::NodePool pool;
+        auto root = build(tree->description, *tree, pool, report);
+        manager_.stageTree(std::move(pool), root->getNameRef());
+        // The previous tree (and the nodes only it referenced) is released on this thread.
+        last_tree_ = std::move(tree);
+        return report;
+    }
+
+    std::shared_ptr<NodeInterface> build(const NodeDescription& description, BuiltTree& tree,
+                                         BTManager::NodePool& pool, ReloadReport& report) const {
+        const uint64_t hash = structuralHash(description);
+        if (auto reused = findReusable(hash, description)) {
+            adopt(description, hash, reused, tree, pool, report);
+            return reused;
+        }
+
+        std::vector<std::shared_ptr<NodeInterface>> children;
+        children.reserve(description.children.size());
+        for (const auto& child : description.children) {
+            children.emplace_back(build(child, tree, pool, report));
+        }
+        auto node = factory_.build(description, std::move(children));
+        addToPool(pool, node);
+        tree.index.emplace(hash, IndexEntry{&description, node});
+        ++report.created_nodes;
+        return node;
+    }
+
+    /** @brief Adds a reused subtree to the new pool and index. */
+    void adopt(const NodeDescription& description, uint64_t hash, const std::shared_ptr<NodeInterface>& node,
+               BuiltTree& tree, BTManager::NodePool& pool, ReloadReport& report) const {
+        addToPool(pool, node);
+        tree.index.emplace(hash, IndexEntry{&description, node});
+        ++report.reused_nodes;
+        for (const auto& child : description.children) {
+            const uint64_t child_hash = structuralHash(child);
+            auto child_node = findReusable(child_hash, child);
+            if (child_node == nullptr) {
+                throw std::logic_error("Reused subtree is missing from the index");
+            }
+            adopt(child, child_hash, child_node, tree, pool, report);
+        }
+    }
+
+    std::shared_ptr<NodeInterface> findReusable(uint64_t hash, const NodeDescription& description) const {
+        if (last_tree_ == nullptr) {
+            return nullptr;
+        }
+        const auto range = last_tree_->index.equal_range(hash);
+        for (auto entry = range.first; entry != range.second; ++entry) {
+            if (*entry->second.description == description) {
+                return entry->second.node;
+            }
+        }
+        return nullptr;
+    }
+
+    static void addToPool(BTManager::NodePool& pool, const std::shared_ptr<NodeInterface>& node) {
+        if (!pool.emplace(node->getNameRef(), node).second) {
+            throw std::runtime_error("Node name duplicated: " + node->getNameRef());
+        }
+    }
+
+    BTManager& manager_;
+    NodeFactory factory_;
+    std::mutex build_mutex_;
+    std::unique_ptr<BuiltTree> last_tree_;
+    std::shared_future<ReloadReport> pending_;
+};
+
+}  // namespace behavior_tree
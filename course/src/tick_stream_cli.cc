@@ -0,0 +1,105 @@
+/**
+ * @file tick_stream_cli.cc
+ * @brief Attaches to the tick stream of a running tree and prints or records it.
+ *
+ *        Usage: bt_tick_stream <shared_memory_name> [--csv <file>] [--from-start]
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TickStream.hpp"
+
+namespace {
+
+volatile std::sig_atomic_t running = 1;
+
+void stop(int signal) {
+    (void)signal;
+    running = 0;
+}
+
+const char* toString(behavior_tree::NodeResult result) {
+    switch (result) {
+        case behavior_tree::NodeResult::SUCCESS:
+            return "SUCCESS";
+        case behavior_tree::NodeResult::RUNNING:
+            return "RUNNING";
+        case behavior_tree::NodeResult::FAILURE:
+            return "FAILURE";
+    }
+    return "UNKNOWN";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <shared_memory_name> [--csv <file>] [--from-start]" << std::endl;
+        return 1;
+    }
+    std::string csv_path;
+    bool from_start = false;
+    for (int arg = 2; arg < argc; ++arg) {
+        if ((std::strcmp(argv[arg], "--csv") == 0) && (arg + 1 < argc)) {
+            csv_path = argv[++arg];
+        } else if (std::strcmp(argv[arg], "--from-start") == 0) {
+            from_start = true;
+        } else {
+            std::cerr << "Unknown argument: " << argv[arg] << std::endl;
+            return 1;
+        }
+    }
+
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+    try {
+        behavior_tree::TickStreamReader reader(argv[1], from_start);
+        std::ofstream csv;
+        if (!csv_path.empty()) {
+            csv.open(csv_path);
+            csv << "index,tick,timestamp_ns,node_id,node,result,depth" << std::endl;
+        }
+
+        std::vector<behavior_tree::TickRecord> records;
+        while (running) {
+            records.clear();
+            if (reader.poll(records) == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+            for (const auto& record : records) {
+                const std::string node = reader.getNodeName(record.node_id);
+                if (csv.is_open()) {
+                    csv << record.index << "," << record.tick << "," << record.timestamp_ns << "," << record.node_id
+                        << "," << node << "," << toString(record.result) << "," << static_cast<int>(record.depth)
+                        << "\n";
+                } else {
+                    std::cout << "tick " << record.tick << " " << std::string(record.depth * 2u, ' ') << node << " "
+                              << toString(record.result) << "\n";
+                }
+            }
+        }
+        std::cerr << "Lost records: " << reader.getLostRecords() << std::endl;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
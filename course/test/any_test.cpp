@@ -12,6 +12,8 @@
 // Standard includes
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 // Challenge includes
 #include "BehaviorTree/Any.hpp"
@@ -50,6 +52,88 @@ TEST_F(AnyTests, AnyTestIncorrectCast) {
     EXPECT_THROW({ uut_double_.get<uint32_t>(); }, std::runtime_error);
 }
 
+TEST_F(AnyTests, AnyTestTryGet) {
+    Any uut_empty_;
+    Any uut_double_(10.0);
+
+    EXPECT_EQ(nullptr, uut_empty_.tryGet<double>());
+    EXPECT_TRUE(uut_empty_.empty());
+    EXPECT_EQ(nullptr, uut_double_.tryGet<int>());
+    ASSERT_NE(nullptr, uut_double_.tryGet<double>());
+    EXPECT_EQ(10.0, *uut_double_.tryGet<double>());
+}
+
+TEST_F(AnyTests, AnyTestTryGetCopiesOnWrite) {
+    Any uut_double_(10.0);
+    Any copy_(uut_double_);
+
+    // The value is copied before it is handed out, so the copy keeps its value.
+    double* value = uut_double_.tryGet<double>();
+    ASSERT_NE(nullptr, value);
+    *value = 20.0;
+    EXPECT_EQ(20.0, uut_double_.get<double>());
+    EXPECT_EQ(10.0, copy_.get<double>());
+}
+
+TEST_F(AnyTests, AnyTestTypeId) {
+    Any uut_uint32_(uint32_t(10));
+
+    EXPECT_TRUE(uut_uint32_.is<uint32_t>());
+    EXPECT_FALSE(uut_uint32_.is<int32_t>());
+    EXPECT_EQ(typeId<uint32_t>(), uut_uint32_.type());
+    EXPECT_NE(typeId<uint32_t>(), typeId<int32_t>());
+    EXPECT_EQ(nullptr, Any().type());
+}
+
+TEST_F(AnyTests, AnyTestSharedPayload) {
+    auto payload = std::make_shared<const std::vector<int>>(1000, 7);
+    Any uut_;
+    EXPECT_THROW(uut_.share(std::shared_ptr<const std::vector<int>>()), std::invalid_argument);
+    uut_.share(payload);
+
+    // Reads reach the payload itself, nothing is copied.
+    EXPECT_TRUE(uut_.isShared());
+    EXPECT_TRUE(uut_.is<std::vector<int>>());
+    const Any& const_uut_ = uut_;
+    EXPECT_EQ(payload.get(), const_uut_.tryGet<std::vector<int>>());
+    EXPECT_EQ(payload, uut_.view<std::vector<int>>());
+    EXPECT_EQ(nullptr, uut_.view<int>());
+    EXPECT_EQ(7, uut_.get<std::vector<int>>()[999]);
+    // It's immutable.
+    EXPECT_EQ(nullptr, uut_.tryGet<std::vector<int>>());
+
+    // Setting a value replaces the payload instead of writing into it.
+    uut_.set(std::vector<int>{1});
+    EXPECT_FALSE(uut_.isShared());
+    EXPECT_EQ(1000u, payload->size());
+    EXPECT_EQ(1u, uut_.get<std::vector<int>>().size());
+}
+
+TEST_F(AnyTests, AnyTestViewOfValue) {
+    Any uut_(std::vector<int>{1, 2, 3});
+    const auto view = uut_.view<std::vector<int>>();
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(view.get(), static_cast<const Any&>(uut_).tryGet<std::vector<int>>());
+
+    // The view keeps seeing the value it was taken from.
+    uut_.set(std::vector<int>{4});
+    EXPECT_EQ(3u, view->size());
+    EXPECT_EQ(4, uut_.get<std::vector<int>>()[0]);
+}
+
+TEST_F(AnyTests, AnyTestViewSurvivesTryGetWrite) {
+    Any uut_(std::vector<int>{1, 2, 3});
+    const auto view = uut_.view<std::vector<int>>();
+
+    // Writing through tryGet copies the value first.
+    std::vector<int>* value = uut_.tryGet<std::vector<int>>();
+    ASSERT_NE(nullptr, value);
+    value->push_back(4);
+    EXPECT_NE(view.get(), value);
+    EXPECT_EQ(3u, view->size());
+    EXPECT_EQ(4u, uut_.get<std::vector<int>>().size());
+}
+
 }  // namespace test
 
 }  // namespace behavior_tree
@@ -12,6 +12,8 @@
 // Standard includes
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 // Challenge includes
 #include "BehaviorTree/Any.hpp"
@@ -62,6 +64,58 @@ TEST_F(BlackboardTest, BlackboardSetAndGet) {
     EXPECT_EQ(any_double_.get<double>(), result_double.get<double>());
 }
 
+TEST_F(BlackboardTest, BlackboardTryGet) {
+    // Create the blackboard
+    Blackboard uut_;
+    uut_.set("any_double", Any(10.0));
+
+    // Missing keys and types don't throw.
+    EXPECT_EQ(nullptr, uut_.tryGet("any_string"));
+    EXPECT_EQ(nullptr, uut_.tryGet<double>("any_string"));
+    EXPECT_EQ(nullptr, uut_.tryGet<int>("any_double"));
+    EXPECT_FALSE(uut_.contains("any_string"));
+
+    EXPECT_TRUE(uut_.contains("any_double"));
+    ASSERT_NE(nullptr, uut_.tryGet("any_double"));
+    ASSERT_NE(nullptr, uut_.tryGet<double>("any_double"));
+    EXPECT_EQ(10.0, *uut_.tryGet<double>("any_double"));
+}
+
+TEST_F(BlackboardTest, BlackboardPublishAndView) {
+    // Counts the releases of the payload.
+    auto released = std::make_shared<int>(0);
+    std::shared_ptr<const std::vector<uint8_t>> payload(new std::vector<uint8_t>(1024, 1),
+                                                        [released](const std::vector<uint8_t>* buffer) {
+                                                            ++*released;
+                                                            delete buffer;
+                                                        });
+    const std::vector<uint8_t>* address = payload.get();
+
+    Blackboard uut_;
+    uut_.publish("cloud", std::move(payload));
+    EXPECT_EQ(1u, uut_.getWriteCount());
+    EXPECT_EQ(address, uut_.tryGet<std::vector<uint8_t>>("cloud"));
+    EXPECT_EQ(nullptr, uut_.view<std::vector<uint8_t>>("missing"));
+    EXPECT_EQ(nullptr, uut_.view<int>("cloud"));
+
+    auto first_view = uut_.view<std::vector<uint8_t>>("cloud");
+    auto second_view = uut_.view<std::vector<uint8_t>>("cloud");
+    EXPECT_EQ(address, first_view.get());
+    EXPECT_EQ(address, second_view.get());
+
+    // The payload lives until the last view is dropped.
+    uut_.publish("cloud", std::make_shared<const std::vector<uint8_t>>(16, 2));
+    EXPECT_EQ(16u, uut_.view<std::vector<uint8_t>>("cloud")->size());
+    first_view.reset();
+    EXPECT_EQ(0, *released);
+    second_view.reset();
+    EXPECT_EQ(1, *released);
+
+    // Values stored through set can be viewed as well.
+    uut_.set("value", 5.0);
+    EXPECT_EQ(5.0, *uut_.view<double>("value"));
+}
+
 }  // namespace test
 
 }  // namespace behavior_tree
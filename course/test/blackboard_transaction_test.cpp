@@ -0,0 +1,181 @@
+/**
+ * @file blackboard_transaction_test.cpp
+ * @brief Tests of the transactional writes and the multi-key reads of the blackboard.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/BlackboardTransaction.hpp"
+
+// Testing
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+class BlackboardTransactionTest : public Test {
+   protected:
+    Blackboard blackboard_;
+};
+
+// Nothing is visible until the commit, which bumps the version once.
+TEST_F(BlackboardTransactionTest, CommitIsAtomic) {
+    blackboard_.set("pose", 1.0);
+    const uint64_t version = blackboard_.getVersion();
+    EXPECT_EQ(version, 1u);
+
+    BlackboardTransaction transaction(blackboard_);
+    transaction.set("pose", 2.0);
+    transaction.set("covariance", std::vector<double>{0.1, 0.2});
+    transaction.set("stamp", Any(int64_t{42}));
+    EXPECT_EQ(transaction.getStagedCount(), 3u);
+    EXPECT_EQ(*blackboard_.tryGet<double>("pose"), 1.0);
+    EXPECT_FALSE(blackboard_.contains("stamp"));
+
+    EXPECT_EQ(transaction.commit(), version + 1);
+    EXPECT_EQ(blackboard_.getVersion(), version + 1);
+    EXPECT_EQ(blackboard_.getWriteCount(), 4u);
+    EXPECT_EQ(blackboard_.getSize(), 3u);
+    EXPECT_EQ(transaction.getStagedCount(), 0u);
+    EXPECT_EQ(*blackboard_.tryGet<double>("pose"), 2.0);
+    EXPECT_EQ(blackboard_.tryGet<std::vector<double>>("covariance")->size(), 2u);
+    EXPECT_EQ(*blackboard_.tryGet<int64_t>("stamp"), 42);
+
+    // Empty commits don't change the version.
+    EXPECT_EQ(transaction.commit(), version + 1);
+}
+
+// The transaction is reused tick after tick, with or without the same keys.
+TEST_F(BlackboardTransactionTest, Reuse) {
+    BlackboardTransaction transaction(blackboard_);
+    for (int tick = 0; tick < 10; ++tick) {
+        transaction.set("a", tick);
+        transaction.set("b", tick * 2);
+        if ((tick % 2) == 0) {
+            transaction.set("even", tick);
+        }
+        // The last value of a key staged twice wins.
+        transaction.set("a", tick + 100);
+        transaction.commit();
+        EXPECT_EQ(*blackboard_.tryGet<int>("a"), tick + 100);
+        EXPECT_EQ(*blackboard_.tryGet<int>("b"), tick * 2);
+    }
+    EXPECT_EQ(*blackboard_.tryGet<int>("even"), 8);
+    EXPECT_EQ(blackboard_.getVersion(), 10u);
+
+    // Discarded values are never written, and the type of a key can change.
+    transaction.set("a", std::string("discarded"));
+    transaction.discard();
+    transaction.set("b", std::string("text"));
+    transaction.commit();
+    EXPECT_EQ(*blackboard_.tryGet<int>("a"), 109);
+    EXPECT_EQ(*blackboard_.tryGet<std::string>("b"), "text");
+}
+
+// Values read before a commit keep their value.
+TEST_F(BlackboardTransactionTest, GetMany) {
+    BlackboardTransaction transaction(blackboard_);
+    transaction.set("x", 1);
+    transaction.set("y", 2);
+    transaction.commit();
+
+    const auto values = blackboard_.getMany("x", std::string("y"), "missing");
+    EXPECT_EQ(*values[0].tryGet<int>(), 1);
+    EXPECT_EQ(*values[1].tryGet<int>(), 2);
+    EXPECT_TRUE(values[2].empty());
+
+    transaction.set("x", 10);
+    transaction.commit();
+    EXPECT_EQ(*values[0].tryGet<int>(), 1);
+    EXPECT_EQ(*blackboard_.getMany("x")[0].tryGet<int>(), 10);
+}
+
+// Another thread never sees a commit half applied.
+TEST_F(BlackboardTransactionTest, ConcurrentReaders) {
+    constexpr int64_t kCommits = 20000;
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        BlackboardTransaction transaction(blackboard_);
+        for (int64_t commit = 0; commit < kCommits; ++commit) {
+            transaction.set("pose", commit);
+            transaction.set("covariance", std::vector<int64_t>(3, commit));
+            transaction.set("stamp", commit);
+            transaction.commit();
+        }
+        done.store(true);
+    });
+
+    bool consistent = true;
+    uint64_t reads = 0;
+    while (!done.load()) {
+        const auto values = blackboard_.getMany("pose", "covariance", "stamp");
+        if (values[0].empty()) {
+            continue;
+        }
+        const int64_t pose = *values[0].tryGet<int64_t>();
+        consistent = consistent && (values[1].tryGet<std::vector<int64_t>>()->back() == pose) &&
+                     (*values[2].tryGet<int64_t>() == pose);
+        ++reads;
+    }
+    writer.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_GT(reads, 0u);
+    EXPECT_EQ(blackboard_.getVersion(), static_cast<uint64_t>(kCommits));
+}
+
+#ifndef BEHAVIOR_TREE_THREAD_SANITIZER
+// Values written in place while other threads drop their copies are never seen half written.
+// ThreadSanitizer builds never write in place, so the test only runs in the other builds.
+TEST_F(BlackboardTransactionTest, InPlaceWritesWithConcurrentReaders) {
+    constexpr int64_t kWrites = 20000;
+    blackboard_.set("samples", std::vector<int64_t>(64, -1));
+    std::atomic<bool> done{false};
+    uint64_t in_place = 0;
+    std::thread writer([&]() {
+        for (int64_t write = 0; write < kWrites; ++write) {
+            const auto* before = blackboard_.tryGet<std::vector<int64_t>>("samples");
+            blackboard_.set("samples", std::vector<int64_t>(64, write));
+            in_place += (blackboard_.tryGet<std::vector<int64_t>>("samples") == before) ? 1 : 0;
+        }
+        done.store(true);
+    });
+
+    bool consistent = true;
+    while (!done.load()) {
+        const auto values = blackboard_.getMany("samples");
+        const auto& samples = *values[0].tryGet<std::vector<int64_t>>();
+        for (const int64_t sample : samples) {
+            consistent = consistent && (sample == samples.front());
+        }
+    }
+    writer.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_GT(in_place, 0u);
+}
+#endif
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -10,13 +10,19 @@
  */
 
 // Standard includes
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 // Challenge includes
 #include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/Clock.hpp"
 #include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/LazySubtreeNode.hpp"
 #include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
 
 // Testing
 #include <gmock/gmock.h>
@@ -31,6 +37,7 @@ namespace test {
 class ChildNodeMock : public NodeInterface {
    public:
     ChildNodeMock() : NodeInterface("mocked_node") {}
+    explicit ChildNodeMock(const std::string& name) : NodeInterface(name) {}
     MOCK_METHOD0(tick, NodeResult());
 };
 
@@ -113,6 +120,151 @@ TEST_F(BTManagerTest, MultipleNodes) {
     EXPECT_EQ(uut_.run(2), NodeResult::FAILURE);
 }
 
+// Checks that a manager in EAGER mode decides a sequence of instantaneous nodes in one tick.
+TEST_F(BTManagerTest, EagerModeReducesTicks) {
+    // Create the blackboards
+    BTManager step_uut_;
+    BTManager eager_uut_(TickMode::EAGER);
+
+    for (BTManager* uut_ : {&step_uut_, &eager_uut_}) {
+        // Build the object and set the expectations
+        std::vector<std::shared_ptr<NodeInterface>> children;
+        for (int i = 0; i < 3; ++i) {
+            auto mock_node = uut_->makeNode<ChildNodeMock>("mocked_node_" + std::to_string(i));
+            EXPECT_CALL(*mock_node, tick()).WillOnce(Return(NodeResult::SUCCESS));
+            children.emplace_back(mock_node);
+        }
+        uut_->makeNode<SequenceNode>("sequence", children);
+
+        // Test
+        EXPECT_EQ(uut_->run(10), NodeResult::SUCCESS);
+    }
+    EXPECT_EQ(step_uut_.getLastTickCount(), 3u);
+    EXPECT_EQ(eager_uut_.getLastTickCount(), 1u);
+}
+
+// Checks that a STEP manager keeps the tick mode given to the constructor of a node.
+TEST_F(BTManagerTest, ExplicitTickModeIsKept) {
+    // Create the blackboard
+    BTManager uut_;
+
+    // Build the object and set the expectations
+    std::vector<std::shared_ptr<NodeInterface>> children;
+    for (int i = 0; i < 3; ++i) {
+        auto mock_node = uut_.makeNode<ChildNodeMock>("mocked_node_" + std::to_string(i));
+        EXPECT_CALL(*mock_node, tick()).WillOnce(Return(NodeResult::SUCCESS));
+        children.emplace_back(mock_node);
+    }
+    uut_.makeNode<SequenceNode>("sequence", children, TickMode::EAGER);
+
+    // Test
+    EXPECT_EQ(uut_.run(10), NodeResult::SUCCESS);
+    EXPECT_EQ(uut_.getLastTickCount(), 1u);
+}
+
+// Checks that the manager releases the idle lazy subtrees of its pool.
+TEST_F(BTManagerTest, ReleaseIdleSubtrees) {
+    // Create the blackboard
+    BTManager uut_;
+    auto clock = std::make_shared<ManualClock>();
+
+    // Build the object and set the expectations
+    auto lazy_node = uut_.makeNode<LazySubtreeNode>(
+        "lazy",
+        []() {
+            auto mock_node = std::make_shared<ChildNodeMock>();
+            EXPECT_CALL(*mock_node, tick()).WillOnce(Return(NodeResult::SUCCESS));
+            return mock_node;
+        },
+        std::chrono::seconds(1), clock);
+
+    // Test
+    EXPECT_EQ(uut_.run(2), NodeResult::SUCCESS);
+    EXPECT_EQ(uut_.releaseIdleSubtrees(), 0u);
+    clock->advance(std::chrono::seconds(1));
+    EXPECT_EQ(uut_.releaseIdleSubtrees(), 1u);
+    EXPECT_FALSE(lazy_node->isMaterialized());
+}
+
+// Checks that the lazy nodes built by another lazy node are released too.
+TEST_F(BTManagerTest, ReleaseIdleNestedSubtrees) {
+    // Create the blackboard
+    BTManager uut_;
+    auto clock = std::make_shared<ManualClock>();
+
+    // Build the object and set the expectations
+    std::shared_ptr<LazySubtreeNode> inner;
+    auto outer = uut_.makeNode<LazySubtreeNode>(
+        "outer",
+        [&inner, clock]() {
+            inner = std::make_shared<LazySubtreeNode>(
+                "inner",
+                []() {
+                    auto mock_node = std::make_shared<ChildNodeMock>();
+                    EXPECT_CALL(*mock_node, tick()).WillOnce(Return(NodeResult::SUCCESS));
+                    return mock_node;
+                },
+                std::chrono::seconds(1), clock);
+            return inner;
+        },
+        std::chrono::seconds(10), clock);
+
+    // Test
+    EXPECT_EQ(uut_.run(2), NodeResult::SUCCESS);
+    ASSERT_NE(inner, nullptr);
+    EXPECT_TRUE(inner->isMaterialized());
+    clock->advance(std::chrono::seconds(1));
+    EXPECT_EQ(uut_.releaseIdleSubtrees(), 1u);
+    EXPECT_TRUE(outer->isMaterialized());
+    EXPECT_FALSE(inner->isMaterialized());
+}
+
+// Checks that the nodes built by a lazy node are registered with the manager, keeping their ids
+// when they are built again.
+TEST_F(BTManagerTest, LazySubtreeNodesAreRegistered) {
+    // Create the blackboard
+    BTManager uut_(TickMode::EAGER);
+    auto statistics = uut_.enableStatistics();
+    auto clock = std::make_shared<ManualClock>();
+
+    // Build the object and set the expectations
+    uut_.makeNode<LazySubtreeNode>(
+        "lazy",
+        []() {
+            auto first = std::make_shared<ChildNodeMock>("first");
+            auto second = std::make_shared<ChildNodeMock>("second");
+            EXPECT_CALL(*first, tick()).WillOnce(Return(NodeResult::SUCCESS));
+            EXPECT_CALL(*second, tick()).WillOnce(Return(NodeResult::SUCCESS));
+            return std::make_shared<SequenceNode>("sequence",
+                                                  std::vector<std::shared_ptr<NodeInterface>>{first, second});
+        },
+        std::chrono::seconds(1), clock);
+
+    // Test
+    // The sequence is EAGER, as the manager, so it ticks both children in one tick.
+    EXPECT_EQ(uut_.run(2), NodeResult::SUCCESS);
+    EXPECT_EQ(uut_.getLastTickCount(), 1u);
+    auto hits = statistics->snapshot().node_hits;
+    ASSERT_EQ(hits.size(), 4u);
+    EXPECT_EQ(hits[1].name, "sequence");
+    EXPECT_EQ(hits[3].name, "second");
+    EXPECT_EQ(hits[3].ticks, 1u);
+
+    clock->advance(std::chrono::seconds(1));
+    EXPECT_EQ(uut_.releaseIdleSubtrees(), 1u);
+    EXPECT_EQ(uut_.run(2), NodeResult::SUCCESS);
+    hits = statistics->snapshot().node_hits;
+    ASSERT_EQ(hits.size(), 4u);
+    EXPECT_EQ(hits[2].name, "first");
+    EXPECT_EQ(hits[2].ticks, 2u);
+    EXPECT_EQ(hits[3].ticks, 2u);
+
+    // Observers added afterwards reach the built nodes too.
+    auto profiler = uut_.enableProfiling();
+    ASSERT_EQ(profiler->getProfiles().size(), 4u);
+    EXPECT_EQ(profiler->getProfiles()[3].name, "second");
+}
+
 }  // namespace test
 
 }  // namespace behavior_tree
@@ -10,15 +10,24 @@
  */
 
 // Standard includes
+#include <chrono>
 #include <memory>
 #include <vector>
 
 // Challenge includes
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/Clock.hpp"
 #include "BehaviorTree/NodeInterface.hpp"
 #include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/AdaptiveFallbackNode.hpp"
+#include "BehaviorTree/Nodes/CooldownNode.hpp"
 #include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/LazySubtreeNode.hpp"
 #include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/RateLimitNode.hpp"
 #include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/Nodes/TimeoutNode.hpp"
+#include "BehaviorTree/Nodes/UtilitySelectorNode.hpp"
 
 // Testing
 #include <gmock/gmock.h>
@@ -280,6 +289,34 @@ TEST_F(GtestGmockTests, FallbackNodeTickNextWhenFailing) {
     EXPECT_EQ(NodeResult::SUCCESS, uut_->tick());
 }
 
+// Testcase in which the fallback is ticked again after succeeding. It should
+// start over from the first child.
+TEST_F(GtestGmockTests, FallbackNodeRestartsAfterSuccess) {
+    // Object to check sequence of expectations.
+    Sequence seq;
+
+    // Children creation.
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+
+    EXPECT_CALL(*child_node_mock_1, tick()).InSequence(seq).WillOnce(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*child_node_mock_2, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*child_node_mock_1, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+
+    // Crete the vector and populates it.
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes;
+    children_nodes.emplace_back(child_node_mock_1);
+    children_nodes.emplace_back(child_node_mock_2);
+
+    // uut
+    auto uut_ = std::make_shared<FallbackNode>("node", children_nodes);
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_->tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_->tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_->tick());
+}
+
 // Testcase in which checks what happends at the end of the execution.
 // If the last child returns failure, it returns failure too.
 TEST_F(GtestGmockTests, FallbackNodeReturningFailureWhenAllFailure) {
@@ -306,6 +343,492 @@ TEST_F(GtestGmockTests, FallbackNodeReturningFailureWhenAllFailure) {
     EXPECT_EQ(NodeResult::FAILURE, uut_->tick());
 }
 
+// Testcase in which the children return success in EAGER mode. All of them
+// should be ticked within the same tick.
+TEST_F(GtestGmockTests, SequenceNodeEagerFinishesInOneTick) {
+    // Object to check sequence of expectations.
+    Sequence seq;
+
+    // Children creation.
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_3 = std::make_shared<ChildNodeMock>();
+
+    // Crete the vector and populates it.
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes;
+    children_nodes.emplace_back(child_node_mock_1);
+    children_nodes.emplace_back(child_node_mock_2);
+    children_nodes.emplace_back(child_node_mock_3);
+
+    // uut
+    auto uut_ = std::make_shared<SequenceNode>("node", children_nodes, TickMode::EAGER);
+
+    EXPECT_CALL(*child_node_mock_1, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*child_node_mock_2, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*child_node_mock_3, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+
+    // Test
+    EXPECT_EQ(NodeResult::SUCCESS, uut_->tick());
+}
+
+// Testcase in which a child returns RUNNING in EAGER mode. The sequence should
+// stop there and resume from that child in the next tick.
+TEST_F(GtestGmockTests, SequenceNodeEagerStopsWhenRunning) {
+    // Object to check sequence of expectations.
+    Sequence seq;
+
+    // Children creation.
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_3 = std::make_shared<ChildNodeMock>();
+
+    // Crete the vector and populates it.
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes;
+    children_nodes.emplace_back(child_node_mock_1);
+    children_nodes.emplace_back(child_node_mock_2);
+    children_nodes.emplace_back(child_node_mock_3);
+
+    // uut
+    auto uut_ = std::make_shared<SequenceNode>("node", children_nodes);
+    uut_->setTickMode(TickMode::EAGER);
+
+    EXPECT_CALL(*child_node_mock_1, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*child_node_mock_2, tick())
+        .InSequence(seq)
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*child_node_mock_3, tick()).InSequence(seq).WillOnce(Return(NodeResult::FAILURE));
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_->tick());
+    // A failure restarts the sequence and ends the tick.
+    EXPECT_EQ(NodeResult::RUNNING, uut_->tick());
+}
+
+// Testcase in which the children fail in EAGER mode. The fallback should keep
+// ticking them within the same tick until one of them succeeds.
+TEST_F(GtestGmockTests, FallbackNodeEagerTicksNextInSameTick) {
+    // Object to check sequence of expectations.
+    Sequence seq;
+
+    // Children creation.
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_3 = std::make_shared<ChildNodeMock>();
+
+    EXPECT_CALL(*child_node_mock_1, tick()).InSequence(seq).WillOnce(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*child_node_mock_2, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*child_node_mock_3, tick()).Times(0).InSequence(seq);
+
+    // Crete the vector and populates it.
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes;
+    children_nodes.emplace_back(child_node_mock_1);
+    children_nodes.emplace_back(child_node_mock_2);
+    children_nodes.emplace_back(child_node_mock_3);
+
+    // uut
+    auto uut_ = std::make_shared<FallbackNode>("node", children_nodes, TickMode::EAGER);
+
+    // Test
+    EXPECT_EQ(NodeResult::SUCCESS, uut_->tick());
+}
+
+// Testcase in which all the children fail in EAGER mode. The fallback should
+// return FAILURE in a single tick.
+TEST_F(GtestGmockTests, FallbackNodeEagerReturnsFailureInOneTick) {
+    // Children creation.
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+
+    EXPECT_CALL(*child_node_mock_1, tick()).WillOnce(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*child_node_mock_2, tick()).WillOnce(Return(NodeResult::FAILURE));
+
+    // Crete the vector and populates it.
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes;
+    children_nodes.emplace_back(child_node_mock_1);
+    children_nodes.emplace_back(child_node_mock_2);
+
+    // uut
+    auto uut_ = std::make_shared<FallbackNode>("node", children_nodes, TickMode::EAGER);
+
+    // Test
+    EXPECT_EQ(NodeResult::FAILURE, uut_->tick());
+}
+
+// Test for checking the case when an nullptr child is passed to the decorators.
+TEST_F(GtestGmockTests, DecoratorsEmptyChildTest) {
+    auto clock = std::make_shared<ManualClock>();
+    EXPECT_THROW({ RateLimitNode uut_("node", nullptr, std::chrono::milliseconds(10), clock); },
+                 std::invalid_argument);
+    EXPECT_THROW({ RateLimitNode uut_("node", nullptr, 2u); }, std::invalid_argument);
+    EXPECT_THROW({ CooldownNode uut_("node", nullptr, std::chrono::milliseconds(10), clock); },
+                 std::invalid_argument);
+    EXPECT_THROW({ TimeoutNode uut_("node", nullptr, std::chrono::milliseconds(10), clock); }, std::invalid_argument);
+}
+
+// Testcase in which the rate limit is measured in time. In between, the last
+// result of the child is returned.
+TEST_F(GtestGmockTests, RateLimitNodeTimePeriod) {
+    auto clock = std::make_shared<ManualClock>();
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    RateLimitNode uut_("node", child_node_mock, std::chrono::milliseconds(10), clock);
+
+    EXPECT_CALL(*child_node_mock, tick()).WillOnce(Return(NodeResult::RUNNING)).WillOnce(Return(NodeResult::SUCCESS));
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    clock->advance(std::chrono::milliseconds(9));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    clock->advance(std::chrono::milliseconds(1));
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+}
+
+// Testcase in which the rate limit is measured in ticks.
+TEST_F(GtestGmockTests, RateLimitNodeTickPeriod) {
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    RateLimitNode uut_("node", child_node_mock, 3u);
+
+    EXPECT_CALL(*child_node_mock, tick()).WillOnce(Return(NodeResult::FAILURE)).WillOnce(Return(NodeResult::SUCCESS));
+
+    // Test
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+}
+
+// Testcase in which the child succeeds. It should not be ticked again until the
+// cooldown elapses.
+TEST_F(GtestGmockTests, CooldownNodeSuppressesAfterSuccess) {
+    auto clock = std::make_shared<ManualClock>();
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    CooldownNode uut_("node", child_node_mock, std::chrono::seconds(1), clock);
+
+    EXPECT_CALL(*child_node_mock, tick())
+        .WillOnce(Return(NodeResult::FAILURE))
+        .WillOnce(Return(NodeResult::SUCCESS))
+        .WillOnce(Return(NodeResult::RUNNING));
+
+    // Test
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    clock->advance(std::chrono::milliseconds(999));
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    clock->advance(std::chrono::milliseconds(1));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+}
+
+// Testcase in which the child keeps running for longer than the timeout.
+TEST_F(GtestGmockTests, TimeoutNodeFailsLongRunningChild) {
+    auto clock = std::make_shared<ManualClock>();
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    TimeoutNode uut_("node", child_node_mock, std::chrono::milliseconds(100), clock);
+
+    EXPECT_CALL(*child_node_mock, tick())
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::SUCCESS));
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    clock->advance(std::chrono::milliseconds(99));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    clock->advance(std::chrono::milliseconds(1));
+    // The child is not ticked once the timeout elapsed.
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    // The next tick starts a new timeout.
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    clock->advance(std::chrono::milliseconds(50));
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+}
+
+// Testcase in which the timeout halts a sequence, which starts over from its first child.
+TEST_F(GtestGmockTests, TimeoutNodeRestartsHaltedSequence) {
+    auto clock = std::make_shared<ManualClock>();
+    auto first_child = std::make_shared<ChildNodeMock>();
+    auto second_child = std::make_shared<ChildNodeMock>();
+    auto sequence = std::make_shared<SequenceNode>(
+        "sequence", std::vector<std::shared_ptr<NodeInterface>>{first_child, second_child});
+    TimeoutNode uut_("node", sequence, std::chrono::milliseconds(100), clock);
+    Sequence seq;
+    EXPECT_CALL(*first_child, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*second_child, tick()).InSequence(seq).WillOnce(Return(NodeResult::RUNNING));
+    EXPECT_CALL(*first_child, tick()).InSequence(seq).WillOnce(Return(NodeResult::SUCCESS));
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    clock->advance(std::chrono::milliseconds(100));
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    // The first child is ticked again.
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+}
+
+// Test for checking the arguments of the utility selector.
+TEST_F(GtestGmockTests, UtilitySelectorNodeInvalidArguments) {
+    auto blackboard = std::make_shared<Blackboard>();
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes{child_node_mock};
+
+    EXPECT_THROW({ UtilitySelectorNode uut_("node", nullptr, {"x"}, children_nodes, {{0.0f, {1.0f}}}); },
+                 std::invalid_argument);
+    EXPECT_THROW({ UtilitySelectorNode uut_("node", blackboard, {"x"}, children_nodes, {}); }, std::invalid_argument);
+    EXPECT_THROW({ UtilitySelectorNode uut_("node", blackboard, {"x"}, children_nodes, {{0.0f, {1.0f, 2.0f}}}); },
+                 std::invalid_argument);
+    EXPECT_THROW({ UtilitySelectorNode uut_("node", blackboard, {"x"}, {nullptr}, {{0.0f, {1.0f}}}); },
+                 std::invalid_argument);
+}
+
+// Testcase in which the inputs change the best scored child.
+TEST_F(GtestGmockTests, UtilitySelectorNodeTicksBestScore) {
+    auto blackboard = std::make_shared<Blackboard>();
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes{child_node_mock_1, child_node_mock_2};
+
+    // Child 1 likes x, child 2 likes y.
+    UtilitySelectorNode uut_("node", blackboard, {"x", "y"}, children_nodes,
+                             {{0.0f, {1.0f, 0.0f}}, {0.5f, {0.0f, 1.0f}}});
+
+    EXPECT_CALL(*child_node_mock_1, tick()).WillOnce(Return(NodeResult::RUNNING));
+    EXPECT_CALL(*child_node_mock_2, tick()).WillOnce(Return(NodeResult::SUCCESS)).WillOnce(Return(NodeResult::FAILURE));
+
+    // Test: the inputs are missing, so only the bias counts.
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_EQ(1u, uut_.getSelected());
+
+    blackboard->set("x", Any(2.0));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(0u, uut_.getSelected());
+    EXPECT_FLOAT_EQ(2.0f, uut_.getScores()[0]);
+    EXPECT_FLOAT_EQ(0.5f, uut_.getScores()[1]);
+
+    blackboard->set("y", Any(2.0f));
+    EXPECT_EQ(NodeResult::FAILURE, uut_.tick());
+    EXPECT_EQ(1u, uut_.getSelected());
+}
+
+// Testcase in which the hysteresis keeps the selected child.
+TEST_F(GtestGmockTests, UtilitySelectorNodeHysteresis) {
+    auto blackboard = std::make_shared<Blackboard>();
+    auto child_node_mock_1 = std::make_shared<ChildNodeMock>();
+    auto child_node_mock_2 = std::make_shared<ChildNodeMock>();
+    std::vector<std::shared_ptr<NodeInterface>> children_nodes{child_node_mock_1, child_node_mock_2};
+
+    UtilitySelectorNode uut_("node", blackboard, {"x"}, children_nodes, {{1.0f, {0.0f}}, {0.0f, {1.0f}}}, 0.5f);
+
+    EXPECT_CALL(*child_node_mock_1, tick()).Times(2).WillRepeatedly(Return(NodeResult::RUNNING));
+    EXPECT_CALL(*child_node_mock_2, tick()).WillOnce(Return(NodeResult::RUNNING));
+
+    // Test
+    blackboard->set("x", Any(0.0));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(0u, uut_.getSelected());
+    // Child 2 is better, but not by more than the hysteresis.
+    blackboard->set("x", Any(1.4));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(0u, uut_.getSelected());
+    blackboard->set("x", Any(1.6));
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(1u, uut_.getSelected());
+}
+
+// Test for checking the case when an empty factory is passed as parameter.
+TEST_F(GtestGmockTests, LazySubtreeNodeEmptyFactoryTest) {
+    EXPECT_THROW({ LazySubtreeNode uut_("node", LazySubtreeNode::Factory()); }, std::invalid_argument);
+    EXPECT_THROW({ LazySubtreeNode uut_("node", nullptr, std::make_shared<NodeFactory>()); }, std::invalid_argument);
+}
+
+// Testcase in which the subtree is built on the first tick and released when idle.
+TEST_F(GtestGmockTests, LazySubtreeNodeMaterializesAndReleases) {
+    auto clock = std::make_shared<ManualClock>();
+    uint32_t built = 0;
+    std::shared_ptr<ChildNodeMock> child_node_mock;
+    LazySubtreeNode uut_(
+        "node",
+        [&]() {
+            ++built;
+            child_node_mock = std::make_shared<ChildNodeMock>();
+            EXPECT_CALL(*child_node_mock, tick())
+                .WillOnce(Return(NodeResult::RUNNING))
+                .WillRepeatedly(Return(NodeResult::SUCCESS));
+            return child_node_mock;
+        },
+        std::chrono::seconds(1), clock);
+
+    // Test: nothing is built until the first tick.
+    EXPECT_FALSE(uut_.isMaterialized());
+    EXPECT_FALSE(uut_.releaseIdle());
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_TRUE(uut_.isMaterialized());
+    EXPECT_EQ(1u, built);
+
+    // A RUNNING subtree is never released.
+    clock->advance(std::chrono::seconds(2));
+    EXPECT_FALSE(uut_.releaseIdle());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+
+    clock->advance(std::chrono::milliseconds(999));
+    EXPECT_FALSE(uut_.releaseIdle());
+    clock->advance(std::chrono::milliseconds(1));
+    EXPECT_TRUE(uut_.releaseIdle());
+    EXPECT_FALSE(uut_.isMaterialized());
+
+    // The next tick builds it again.
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(2u, built);
+}
+
+// Testcase in which the subtree is built from a description.
+TEST_F(GtestGmockTests, LazySubtreeNodeFromDescription) {
+    auto node_factory = std::make_shared<NodeFactory>();
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    EXPECT_CALL(*child_node_mock, tick()).WillOnce(Return(NodeResult::FAILURE));
+    node_factory->registerBuilder("Mock", [&](const NodeDescription& description,
+                                               std::vector<std::shared_ptr<NodeInterface>> children) {
+        (void)description;
+        (void)children;
+        return child_node_mock;
+    });
+    auto description = std::make_shared<NodeDescription>(
+        NodeDescription{"Negation", "negation", {}, {NodeDescription{"Mock", "mocked_child", {}, {}}}});
+
+    LazySubtreeNode uut_("node", description, node_factory);
+
+    // Test
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+}
+
+// Test for checking the case when invalid arguments are passed as parameter.
+TEST_F(GtestGmockTests, AdaptiveFallbackNodeInvalidArguments) {
+    auto child_node_mock = std::make_shared<ChildNodeMock>();
+    EXPECT_THROW({ AdaptiveFallbackNode uut_("node", {child_node_mock, nullptr}); }, std::invalid_argument);
+    AdaptiveFallbackOptions options;
+    options.pinned = {1};
+    EXPECT_THROW({ AdaptiveFallbackNode uut_("node", {child_node_mock}, options); }, std::invalid_argument);
+    options.pinned.clear();
+    options.smoothing = 0.0;
+    EXPECT_THROW({ AdaptiveFallbackNode uut_("node", {child_node_mock}, options); }, std::invalid_argument);
+}
+
+// Testcase in which the child that always succeeds ends up being tried first.
+TEST_F(GtestGmockTests, AdaptiveFallbackNodeTriesReliableChildFirst) {
+    auto failing_child = std::make_shared<ChildNodeMock>();
+    auto reliable_child = std::make_shared<ChildNodeMock>();
+    AdaptiveFallbackNode uut_("node", {failing_child, reliable_child}, {}, TickMode::EAGER);
+    EXPECT_CALL(*failing_child, tick()).Times(1).WillRepeatedly(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*reliable_child, tick()).Times(10).WillRepeatedly(Return(NodeResult::SUCCESS));
+
+    // Test: after the first decision the failing child isn't tried again within the exploration period.
+    for (int decision = 0; decision < 10; ++decision) {
+        EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    }
+    EXPECT_EQ((std::vector<size_t>{1, 0}), uut_.getOrder());
+    EXPECT_EQ(1u, uut_.getReorderCount());
+    const auto& statistics = uut_.getChildStatistics(1);
+    EXPECT_EQ(10u, statistics.attempts);
+    EXPECT_EQ(10u, statistics.successes);
+    EXPECT_EQ(0u, statistics.position);
+    EXPECT_LT(uut_.getChildStatistics(0).success_rate, 0.5);
+}
+
+// Testcase in which a child that failed is tried again once the exploration period elapsed.
+TEST_F(GtestGmockTests, AdaptiveFallbackNodeExploresStaleChildren) {
+    auto flaky_child = std::make_shared<ChildNodeMock>();
+    auto reliable_child = std::make_shared<ChildNodeMock>();
+    AdaptiveFallbackOptions options;
+    options.exploration_period = 3;
+    AdaptiveFallbackNode uut_("node", {flaky_child, reliable_child}, options, TickMode::EAGER);
+    EXPECT_CALL(*flaky_child, tick()).WillOnce(Return(NodeResult::FAILURE)).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*reliable_child, tick()).Times(4).WillRepeatedly(Return(NodeResult::SUCCESS));
+
+    // Test
+    for (int decision = 0; decision < 4; ++decision) {
+        EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    }
+    // Not tried since the first decision, the flaky child goes first for one decision.
+    EXPECT_EQ((std::vector<size_t>{0, 1}), uut_.getOrder());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_EQ(5u, uut_.getChildStatistics(0).last_decision);
+    EXPECT_EQ(4u, uut_.getChildStatistics(1).last_decision);
+    // A single success doesn't beat the reliable child.
+    EXPECT_EQ((std::vector<size_t>{1, 0}), uut_.getOrder());
+    EXPECT_EQ(3u, uut_.getReorderCount());
+}
+
+// Testcase in which the cheapest of two reliable children ends up being tried first.
+TEST_F(GtestGmockTests, AdaptiveFallbackNodePrefersCheaperChild) {
+    auto slow_child = std::make_shared<ChildNodeMock>();
+    auto fast_child = std::make_shared<ChildNodeMock>();
+    AdaptiveFallbackNode uut_("node", {slow_child, fast_child});
+    // The slow child needs three ticks to fail, the fast one succeeds in one.
+    EXPECT_CALL(*slow_child, tick())
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*fast_child, tick()).WillRepeatedly(Return(NodeResult::SUCCESS));
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_DOUBLE_EQ(3.0, uut_.getChildStatistics(0).cost);
+    EXPECT_DOUBLE_EQ(1.0, uut_.getChildStatistics(1).cost);
+    EXPECT_EQ((std::vector<size_t>{1, 0}), uut_.getOrder());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+}
+
+// Testcase in which a pinned child keeps its position even though it always fails.
+TEST_F(GtestGmockTests, AdaptiveFallbackNodeKeepsPinnedChildren) {
+    auto pinned_child = std::make_shared<ChildNodeMock>();
+    auto failing_child = std::make_shared<ChildNodeMock>();
+    auto reliable_child = std::make_shared<ChildNodeMock>();
+    AdaptiveFallbackOptions options;
+    options.pinned = {0};
+    AdaptiveFallbackNode uut_("node", {pinned_child, failing_child, reliable_child}, options, TickMode::EAGER);
+    EXPECT_CALL(*pinned_child, tick()).Times(5).WillRepeatedly(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*failing_child, tick()).Times(1).WillRepeatedly(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*reliable_child, tick()).Times(5).WillRepeatedly(Return(NodeResult::SUCCESS));
+
+    // Test
+    for (int decision = 0; decision < 5; ++decision) {
+        EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    }
+    EXPECT_EQ((std::vector<size_t>{0, 2, 1}), uut_.getOrder());
+    EXPECT_TRUE(uut_.getChildStatistics(0).pinned);
+}
+
+// Testcase in which the cost is measured in time.
+TEST_F(GtestGmockTests, AdaptiveFallbackNodeMeasuresTime) {
+    auto clock = std::make_shared<ManualClock>();
+    auto slow_child = std::make_shared<ChildNodeMock>();
+    auto fast_child = std::make_shared<ChildNodeMock>();
+    AdaptiveFallbackOptions options;
+    options.measure_time = true;
+    options.clock = clock;
+    AdaptiveFallbackNode uut_("node", {slow_child, fast_child}, options);
+    EXPECT_CALL(*slow_child, tick()).WillOnce(Invoke([&clock]() {
+        clock->advance(std::chrono::milliseconds(5));
+        return NodeResult::SUCCESS;
+    }));
+    EXPECT_CALL(*fast_child, tick()).WillRepeatedly(Invoke([&clock]() {
+        clock->advance(std::chrono::milliseconds(1));
+        return NodeResult::SUCCESS;
+    }));
+
+    // Test: the fast child hasn't been tried yet, so its expected cost is the lowest.
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_DOUBLE_EQ(5e6, uut_.getChildStatistics(0).cost);
+    EXPECT_EQ((std::vector<size_t>{1, 0}), uut_.getOrder());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_.tick());
+    EXPECT_DOUBLE_EQ(1e6, uut_.getChildStatistics(1).cost);
+    EXPECT_EQ((std::vector<size_t>{1, 0}), uut_.getOrder());
+}
+
 }  // namespace test
 
 }  // namespace behavior_tree
@@ -0,0 +1,57 @@
+/**
+ * @file hot_path_no_exceptions_test.cpp
+ * @brief Checks that the non-throwing lookups of Any and Blackboard build and work
+ *        with -fno-exceptions -fno-rtti. GoogleTest needs both, so this test
+ *        reports its failures through the exit code instead.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(__GXX_RTTI)
+#error "This test must be built with -fno-exceptions -fno-rtti"
+#endif
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* description) {
+    if (!condition) {
+        std::printf("FAILED: %s\n", description);
+        ++failures;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    using namespace behavior_tree;
+
+    Any any_double(10.0);
+    check(any_double.is<double>(), "Any holds a double");
+    check(any_double.tryGet<int>() == nullptr, "Any type mismatch returns nullptr");
+    check((any_double.tryGet<double>() != nullptr) && (*any_double.tryGet<double>() == 10.0), "Any hit");
+
+    Blackboard blackboard;
+    blackboard.set("uint32", Any(uint32_t(7)));
+    check(blackboard.tryGet("missing") == nullptr, "Blackboard miss returns nullptr");
+    check(blackboard.tryGet<double>("uint32") == nullptr, "Blackboard type mismatch returns nullptr");
+    check((blackboard.tryGet<uint32_t>("uint32") != nullptr) && (*blackboard.tryGet<uint32_t>("uint32") == 7u),
+          "Blackboard hit");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file node_profiler_test.cpp
+ * @brief Tests for the tick observers and the NodeProfiler.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeProfiler.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/TickObserver.hpp"
+
+// Testing
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+class ChildNodeMock : public NodeInterface {
+   public:
+    explicit ChildNodeMock(const std::string& name) : NodeInterface(name) {}
+    MOCK_METHOD0(tick, NodeResult());
+};
+
+// Records the order of the notifications.
+class RecordingObserver : public TickObserver {
+   public:
+    void nodeAdded(NodeInterface& node) override { events_.emplace_back("add " + node.getName()); }
+    void beforeTick(NodeInterface& node) override { events_.emplace_back("before " + node.getName()); }
+    void afterTick(NodeInterface& node, NodeResult result) override {
+        (void)result;
+        events_.emplace_back("after " + node.getName());
+    }
+
+    std::vector<std::string> events_;
+};
+
+class NodeProfilerTest : public Test {
+   public:
+};
+
+// Observers get notified of the nodes created before and after they are added, with nested ticks.
+TEST_F(NodeProfilerTest, ObserverNestedNotifications) {
+    BTManager uut_;
+    auto observer = std::make_shared<RecordingObserver>();
+
+    auto leaf = uut_.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick()).WillOnce(Return(NodeResult::SUCCESS));
+    uut_.addTickObserver(observer);
+    uut_.makeNode<NegationNode>("negation", leaf);
+
+    // Test
+    EXPECT_EQ(uut_.run(2), NodeResult::FAILURE);
+    EXPECT_THAT(observer->events_, ElementsAre("add leaf", "add negation", "before negation", "before leaf",
+                                               "after leaf", "after negation"));
+}
+
+// The profiler counts every tick of every node and keeps exclusive values below inclusive ones.
+TEST_F(NodeProfilerTest, ProfilerAggregatesPerNode) {
+    BTManager uut_;
+    auto profiler = uut_.enableProfiling();
+
+    auto leaf_1 = uut_.makeNode<ChildNodeMock>("leaf_1");
+    auto leaf_2 = uut_.makeNode<ChildNodeMock>("leaf_2");
+    EXPECT_CALL(*leaf_1, tick()).WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*leaf_2, tick()).WillOnce(Return(NodeResult::RUNNING)).WillOnce(Return(NodeResult::SUCCESS));
+    auto root = uut_.makeNode<SequenceNode>("root", std::vector<std::shared_ptr<NodeInterface>>{leaf_1, leaf_2});
+
+    // Test
+    EXPECT_EQ(uut_.run(10), NodeResult::SUCCESS);
+
+    const auto& profiles = profiler->getProfiles();
+    ASSERT_EQ(profiles.size(), 3u);
+    EXPECT_EQ(profiles[leaf_1->getId()].calls, 1u);
+    EXPECT_EQ(profiles[leaf_2->getId()].calls, 2u);
+    EXPECT_EQ(profiles[root->getId()].calls, 3u);
+    for (const auto& profile : profiles) {
+        EXPECT_LE(profile.exclusive_ns, profile.inclusive_ns);
+        for (size_t counter = 0; counter < PerfCounters::COUNTER_COUNT; ++counter) {
+            EXPECT_LE(profile.exclusive_counters[counter], profile.inclusive_counters[counter]);
+        }
+    }
+    EXPECT_GE(profiles[root->getId()].inclusive_ns,
+              profiles[leaf_1->getId()].inclusive_ns + profiles[leaf_2->getId()].inclusive_ns);
+
+    // Reset keeps the names but drops the values.
+    profiler->reset();
+    EXPECT_EQ(profiler->getProfiles()[root->getId()].calls, 0u);
+    EXPECT_EQ(profiler->getProfiles()[root->getId()].name, "root");
+}
+
+// A tick cut short by a node that throws is not measured and doesn't affect the next ones.
+TEST_F(NodeProfilerTest, ProfilerThrowingNode) {
+    BTManager uut_;
+    auto profiler = uut_.enableProfiling();
+
+    auto leaf_1 = uut_.makeNode<ChildNodeMock>("leaf_1");
+    auto leaf_2 = uut_.makeNode<ChildNodeMock>("leaf_2");
+    EXPECT_CALL(*leaf_1, tick())
+        .WillOnce(Throw(std::runtime_error("first tick")))
+        .WillOnce(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*leaf_2, tick()).WillOnce(Return(NodeResult::SUCCESS));
+    auto root = uut_.makeNode<SequenceNode>("root", std::vector<std::shared_ptr<NodeInterface>>{leaf_1, leaf_2});
+
+    // Test
+    EXPECT_THROW(uut_.run(10), std::runtime_error);
+    EXPECT_EQ(uut_.run(10), NodeResult::SUCCESS);
+
+    const auto& profiles = profiler->getProfiles();
+    EXPECT_EQ(profiles[leaf_1->getId()].calls, 1u);
+    EXPECT_EQ(profiles[leaf_2->getId()].calls, 1u);
+    EXPECT_EQ(profiles[root->getId()].calls, 2u);
+    EXPECT_GE(profiles[root->getId()].inclusive_ns,
+              profiles[leaf_1->getId()].inclusive_ns + profiles[leaf_2->getId()].inclusive_ns);
+    EXPECT_LE(profiles[root->getId()].exclusive_ns, profiles[root->getId()].inclusive_ns);
+}
+
+// The report lists the ticked nodes and states when it only has timing information.
+TEST_F(NodeProfilerTest, ProfilerReport) {
+    BTManager uut_;
+    auto profiler = uut_.enableProfiling();
+
+    auto leaf = uut_.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick()).WillOnce(Return(NodeResult::FAILURE));
+    uut_.makeNode<NegationNode>("negation", leaf);
+    EXPECT_EQ(uut_.run(2), NodeResult::SUCCESS);
+
+    std::ostringstream report;
+    profiler->printReport(report);
+
+    // Test
+    EXPECT_THAT(report.str(), HasSubstr("leaf"));
+    EXPECT_THAT(report.str(), HasSubstr("negation"));
+    if (profiler->countersAvailable()) {
+        EXPECT_THAT(report.str(), HasSubstr("cycles"));
+    } else {
+        EXPECT_THAT(report.str(), HasSubstr("timing only"));
+    }
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,345 @@
+/**
+ * @file persistent_blackboard_test.cpp
+ * @brief Tests for the memory-mapped persistent blackboard, including its crash consistency.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// System includes
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/PersistentBlackboard.hpp"
+
+// Testing
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+// Value whose fields must always match, so a torn value is detected.
+struct Pose {
+    uint64_t sequence;
+    double values[30];
+};
+
+bool isConsistent(const Pose& pose) {
+    for (const double value : pose.values) {
+        if (value != static_cast<double>(pose.sequence)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Pose makePose(uint64_t sequence) {
+    Pose pose;
+    pose.sequence = sequence;
+    for (double& value : pose.values) {
+        value = static_cast<double>(sequence);
+    }
+    return pose;
+}
+
+class PersistentBlackboardTest : public Test {
+   public:
+    PersistentBlackboardTest()
+        : path_{"/tmp/bt_persistent_blackboard_test_" + std::to_string(::getpid()) + "_" +
+                UnitTest::GetInstance()->current_test_info()->name()} {
+        ::unlink(path_.c_str());
+    }
+
+    ~PersistentBlackboardTest() { ::unlink(path_.c_str()); }
+
+    // Flips a byte of the file, as a torn page would.
+    void corrupt(size_t offset) {
+        const int fd = ::open(path_.c_str(), O_RDWR);
+        ASSERT_NE(fd, -1);
+        uint8_t byte = 0;
+        ASSERT_EQ(::pread(fd, &byte, 1, static_cast<off_t>(offset)), 1);
+        byte ^= 0xff;
+        ASSERT_EQ(::pwrite(fd, &byte, 1, static_cast<off_t>(offset)), 1);
+        ::close(fd);
+    }
+
+    // Offset of the first value buffer of the only slot of a blackboard with slot_count = 1.
+    size_t valueOffset(uint32_t value_capacity, uint64_t buffer) const {
+        using namespace persistent_blackboard;
+        return alignUp(sizeof(Header)) + kDataOffset + value_capacity * buffer;
+    }
+
+    // Returns true when a writer started by another process is rejected.
+    bool writerInChildIsRejected() {
+        const pid_t child = ::fork();
+        if (child == 0) {
+            try {
+                PersistentBlackboard second(path_);
+            } catch (const std::runtime_error&) {
+                ::_exit(0);
+            }
+            ::_exit(1);
+        }
+        int status = 0;
+        return (child != -1) && (::waitpid(child, &status, 0) == child) && WIFEXITED(status) &&
+               (WEXITSTATUS(status) == 0);
+    }
+
+    std::string path_;
+};
+
+// Values written by a process are found by the next one.
+TEST_F(PersistentBlackboardTest, ReattachKeepsTheValues) {
+    {
+        PersistentBlackboard uut_(path_, {16, 256});
+        EXPECT_FALSE(uut_.contains("pose"));
+        uut_.set("pose", makePose(3));
+        uut_.set("count", int32_t{7});
+        uut_.set("count", int32_t{8});
+        EXPECT_EQ(uut_.getGeneration("count"), 2u);
+    }
+
+    PersistentBlackboard uut_(path_, {1, 1});
+    // The geometry of the file wins over the config.
+    EXPECT_EQ(uut_.getSlotCount(), 16u);
+    EXPECT_EQ(uut_.getValueCapacity(), 256u);
+    EXPECT_EQ(uut_.getRecovery().entries, 2u);
+    EXPECT_EQ(uut_.getRecovery().rolled_back, 0u);
+    EXPECT_EQ(uut_.getWriteCount(), 3u);
+
+    Pose pose{};
+    ASSERT_TRUE(uut_.get("pose", pose));
+    EXPECT_EQ(pose.sequence, 3u);
+    EXPECT_TRUE(isConsistent(pose));
+    int32_t count = 0;
+    ASSERT_TRUE(uut_.get("count", count));
+    EXPECT_EQ(count, 8);
+    EXPECT_EQ(uut_.getGeneration("count"), 2u);
+}
+
+// Keys keep their type, and the limits of the file are enforced.
+TEST_F(PersistentBlackboardTest, TypesAndLimits) {
+    PersistentBlackboard uut_(path_, {2, 8});
+    uut_.set("int", int32_t{1});
+    EXPECT_THROW(uut_.set("int", 1.0), std::invalid_argument);
+    double value = 0;
+    EXPECT_FALSE(uut_.get("int", value));
+    EXPECT_FALSE(uut_.get("missing", value));
+    EXPECT_THROW(uut_.set(std::string(persistent_blackboard::kKeySize, 'k'), 1), std::invalid_argument);
+    // The capacity is rounded up to the alignment.
+    EXPECT_EQ(uut_.getValueCapacity(), persistent_blackboard::kAlignment);
+    EXPECT_THROW(uut_.set("pose", makePose(1)), std::invalid_argument);
+    uut_.set("double", 2.0);
+    EXPECT_THROW(uut_.set("third", 3.0), std::runtime_error);
+}
+
+// Only one process can write the file.
+TEST_F(PersistentBlackboardTest, SecondWriterIsRejected) {
+    PersistentBlackboard uut_(path_);
+    EXPECT_TRUE(writerInChildIsRejected());
+}
+
+// The lock belongs to the writer: other writers of the same process are rejected, and
+// closing other descriptors of the file, as readers and rejected writers do, keeps it.
+TEST_F(PersistentBlackboardTest, LockIsKeptWithinTheProcess) {
+    PersistentBlackboard uut_(path_);
+    EXPECT_THROW(PersistentBlackboard second(path_), std::runtime_error);
+    { PersistentBlackboardReader reader(path_); }
+    EXPECT_TRUE(writerInChildIsRejected());
+    EXPECT_THROW(PersistentBlackboard third(path_), std::runtime_error);
+}
+
+// A reader maps the same pages and sees the values of the writer in place.
+TEST_F(PersistentBlackboardTest, ReaderSeesTheWriter) {
+    PersistentBlackboard uut_(path_);
+    PersistentBlackboardReader reader(path_);
+    EXPECT_FALSE(reader.contains("pose"));
+
+    uut_.set("pose", makePose(5));
+    uint64_t sequence = 0;
+    EXPECT_TRUE(reader.visit<Pose>("pose", [&sequence](const Pose& pose) { sequence = pose.sequence; }));
+    EXPECT_EQ(sequence, 5u);
+    EXPECT_FALSE(reader.visit<int>("pose", [](const int&) {}));
+    EXPECT_THROW(PersistentBlackboardReader("/tmp/bt_persistent_blackboard_missing"), std::runtime_error);
+}
+
+// A reader running along the writer never gets a torn value.
+TEST_F(PersistentBlackboardTest, ConcurrentReaderNeverSeesTornValues) {
+    PersistentBlackboard uut_(path_);
+    uut_.set("pose", makePose(0));
+    PersistentBlackboardReader reader(path_);
+    std::atomic<bool> done{false};
+    uint64_t reads = 0;
+    uint64_t torn = 0;
+    std::thread reading([&]() {
+        uint64_t last = 0;
+        while (!done.load()) {
+            Pose pose{};
+            ASSERT_TRUE(reader.get("pose", pose));
+            torn += isConsistent(pose) ? 0 : 1;
+            EXPECT_GE(pose.sequence, last);
+            last = pose.sequence;
+            ++reads;
+        }
+    });
+    for (uint64_t sequence = 1; sequence <= 200000; ++sequence) {
+        uut_.set("pose", makePose(sequence));
+    }
+    done.store(true);
+    reading.join();
+    EXPECT_GT(reads, 0u);
+    EXPECT_EQ(torn, 0u);
+}
+
+// A writer killed at random points leaves every value consistent, and never older than before.
+TEST_F(PersistentBlackboardTest, SurvivesKilledWriter) {
+    const char* keys[] = {"pose_a", "pose_b", "pose_c", "pose_d"};
+    std::map<std::string, uint64_t> last;
+    for (uint32_t round = 0; round < 8; ++round) {
+        const pid_t child = ::fork();
+        ASSERT_NE(child, -1);
+        if (child == 0) {
+            PersistentBlackboard writer(path_, {8, 512});
+            // Carry on from the newest value left by the previous round.
+            uint64_t sequence = 0;
+            for (const char* key : keys) {
+                Pose pose{};
+                if (writer.get(key, pose) && (pose.sequence > sequence)) {
+                    sequence = pose.sequence;
+                }
+            }
+            for (;;) {
+                for (const char* key : keys) {
+                    writer.set(key, makePose(++sequence));
+                }
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5 + 3 * round));
+        ASSERT_EQ(::kill(child, SIGKILL), 0);
+        int status = 0;
+        ASSERT_EQ(::waitpid(child, &status, 0), child);
+        ASSERT_TRUE(WIFSIGNALED(status));
+
+        PersistentBlackboard uut_(path_);
+        EXPECT_EQ(uut_.getRecovery().lost, 0u);
+        for (const char* key : keys) {
+            Pose pose{};
+            if (!uut_.get(key, pose)) {
+                continue;
+            }
+            EXPECT_TRUE(isConsistent(pose)) << key << " round " << round;
+            EXPECT_GE(pose.sequence, last[key]) << key << " round " << round;
+            last[key] = pose.sequence;
+        }
+    }
+    EXPECT_FALSE(last.empty());
+}
+
+// A value published but torn on disk is replaced by the previous one, or dropped if both are torn.
+TEST_F(PersistentBlackboardTest, TornValuesAreRolledBack) {
+    {
+        PersistentBlackboard uut_(path_, {1, 256});
+        uut_.set("pose", makePose(1));
+        uut_.set("pose", makePose(2));
+    }
+    // Generation 2 lives in buffer 0.
+    corrupt(valueOffset(256, 0) + 8);
+    {
+        PersistentBlackboard uut_(path_);
+        EXPECT_EQ(uut_.getRecovery().rolled_back, 1u);
+        EXPECT_EQ(uut_.getGeneration("pose"), 1u);
+        Pose pose{};
+        ASSERT_TRUE(uut_.get("pose", pose));
+        EXPECT_EQ(pose.sequence, 1u);
+        EXPECT_TRUE(isConsistent(pose));
+    }
+    corrupt(valueOffset(256, 1) + 8);
+    PersistentBlackboard uut_(path_);
+    EXPECT_EQ(uut_.getRecovery().lost, 1u);
+    EXPECT_FALSE(uut_.contains("pose"));
+    // The key keeps its type and can be written again.
+    uut_.set("pose", makePose(4));
+    EXPECT_TRUE(uut_.contains("pose"));
+}
+
+// A file whose creation was interrupted before storing the magic is created again.
+TEST_F(PersistentBlackboardTest, InterruptedCreationStartsOver) {
+    {
+        const int fd = ::open(path_.c_str(), O_RDWR | O_CREAT, 0644);
+        ASSERT_NE(fd, -1);
+        const size_t size = persistent_blackboard::mappingSize(4, 64);
+        ASSERT_EQ(::ftruncate(fd, static_cast<off_t>(size)), 0);
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        ASSERT_NE(mapping, MAP_FAILED);
+        auto* header = static_cast<persistent_blackboard::Header*>(mapping);
+        header->version = persistent_blackboard::kVersion;
+        header->slot_count = 4;
+        header->value_capacity = 64;
+        ::munmap(mapping, size);
+    }
+    EXPECT_THROW(PersistentBlackboardReader reader(path_), std::runtime_error);
+
+    {
+        PersistentBlackboard uut_(path_, {2, 256});
+        EXPECT_EQ(uut_.getSlotCount(), 2u);
+        EXPECT_EQ(uut_.getValueCapacity(), 256u);
+        EXPECT_EQ(uut_.getRecovery().entries, 0u);
+        uut_.set("pose", makePose(1));
+    }
+    PersistentBlackboardReader reader(path_);
+    Pose pose{};
+    ASSERT_TRUE(reader.get("pose", pose));
+    EXPECT_EQ(pose.sequence, 1u);
+}
+
+// A key whose creation was interrupted is dropped.
+TEST_F(PersistentBlackboardTest, InterruptedKeyCreationIsDropped) {
+    { PersistentBlackboard uut_(path_, {1, 64}); }
+    {
+        const int fd = ::open(path_.c_str(), O_RDWR);
+        ASSERT_NE(fd, -1);
+        const size_t size = persistent_blackboard::mappingSize(1, 64);
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        ASSERT_NE(mapping, MAP_FAILED);
+        auto* slot = reinterpret_cast<persistent_blackboard::Slot*>(
+            static_cast<uint8_t*>(mapping) + persistent_blackboard::alignUp(sizeof(persistent_blackboard::Header)));
+        slot->state.store(persistent_blackboard::kClaimed);
+        std::memcpy(slot->key, "half", 4);
+        ::munmap(mapping, size);
+    }
+
+    PersistentBlackboard uut_(path_);
+    EXPECT_EQ(uut_.getRecovery().discarded_claims, 1u);
+    uut_.set("key", 1);
+    EXPECT_TRUE(uut_.contains("key"));
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
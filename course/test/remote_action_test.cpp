@@ -0,0 +1,257 @@
+/**
+ * @file remote_action_test.cpp
+ * @brief Tests of the remote actions against the local stand-in server.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// System includes
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/Clock.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/RemoteActionNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/Nodes/TimeoutNode.hpp"
+#include "BehaviorTree/RemoteAction.hpp"
+#include "BehaviorTree/RemoteActionServer.hpp"
+
+// Testing
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+// Throws on its first tick, succeeds afterwards.
+class ThrowOnceNode : public NodeInterface {
+   public:
+    explicit ThrowOnceNode(const std::string& name) : NodeInterface(name) {}
+
+    NodeResult tick() override {
+        if (!thrown_) {
+            thrown_ = true;
+            throw std::runtime_error("first tick");
+        }
+        return NodeResult::SUCCESS;
+    }
+
+   private:
+    bool thrown_ = false;
+};
+
+class RemoteActionTest : public Test {
+   protected:
+    RemoteActionTest()
+        : socket_path_{"/tmp/bt_remote_action_test_" + std::to_string(::getpid()) + ".sock"},
+          server_{std::make_unique<RemoteActionServer>(socket_path_, [](const std::string& action,
+                                                                        const std::string& arguments) {
+              // "echo" succeeds with its arguments, "slow" answers late, anything else fails.
+              if (action == "echo") {
+                  return RemoteActionReply{NodeResult::SUCCESS, arguments};
+              }
+              if (action == "slow") {
+                  return RemoteActionReply{NodeResult::SUCCESS, "slow " + arguments, std::chrono::milliseconds(50)};
+              }
+              return RemoteActionReply{NodeResult::FAILURE, "unknown action " + action};
+          })},
+          client_{std::make_shared<RemoteActionClient>(socket_path_)} {}
+
+    // Ticks the nodes as a tree would, until none of them is RUNNING.
+    std::vector<NodeResult> tickUntilDone(const std::vector<std::shared_ptr<RemoteActionNode>>& nodes) {
+        std::vector<NodeResult> results(nodes.size(), NodeResult::RUNNING);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        bool running = true;
+        while (running && (std::chrono::steady_clock::now() < deadline)) {
+            client_->poll();
+            running = false;
+            for (size_t node = 0; node < nodes.size(); ++node) {
+                if (results[node] == NodeResult::RUNNING) {
+                    results[node] = nodes[node]->tick();
+                    running = running || (results[node] == NodeResult::RUNNING);
+                }
+            }
+            client_->flush();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return results;
+    }
+
+    std::string socket_path_;
+    std::unique_ptr<RemoteActionServer> server_;
+    std::shared_ptr<RemoteActionClient> client_;
+};
+
+// The node returns RUNNING until the response arrives, then its result.
+TEST_F(RemoteActionTest, RoundTrip) {
+    auto echo = std::make_shared<RemoteActionNode>("echo", client_, "echo", "hello");
+    auto unknown = std::make_shared<RemoteActionNode>("unknown", client_, "missing");
+
+    EXPECT_EQ(echo->tick(), NodeResult::RUNNING);
+    EXPECT_EQ(client_->getPendingCount(), 1u);
+    const auto results = tickUntilDone({echo, unknown});
+    EXPECT_THAT(results, ElementsAre(NodeResult::SUCCESS, NodeResult::FAILURE));
+    EXPECT_EQ(echo->getOutput(), "hello");
+    EXPECT_EQ(unknown->getOutput(), "unknown action missing");
+    EXPECT_EQ(client_->getPendingCount(), 0u);
+
+    // The next tick sends a new request.
+    EXPECT_EQ(echo->tick(), NodeResult::RUNNING);
+    EXPECT_THAT(tickUntilDone({echo}), ElementsAre(NodeResult::SUCCESS));
+    EXPECT_EQ(server_->getRequestCount(), 3u);
+}
+
+// A request given up by a TimeoutNode is cancelled: its late response is dropped and the
+// next activation waits for a new one.
+TEST_F(RemoteActionTest, TimeoutCancelsTheRequest) {
+    auto clock = std::make_shared<ManualClock>();
+    auto slow = std::make_shared<RemoteActionNode>("slow", client_, "slow", "call");
+    TimeoutNode timeout("timeout", slow, std::chrono::milliseconds(10), clock);
+
+    EXPECT_EQ(timeout.tick(), NodeResult::RUNNING);
+    client_->flush();
+    clock->advance(std::chrono::milliseconds(10));
+    EXPECT_EQ(timeout.tick(), NodeResult::FAILURE);
+    EXPECT_EQ(client_->getPendingCount(), 0u);
+
+    // The first response arrives meanwhile, and it is dropped.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    client_->poll();
+    EXPECT_EQ(timeout.tick(), NodeResult::RUNNING);
+    EXPECT_EQ(client_->getPendingCount(), 1u);
+    NodeResult result = NodeResult::RUNNING;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((result == NodeResult::RUNNING) && (std::chrono::steady_clock::now() < deadline)) {
+        client_->flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        client_->poll();
+        result = timeout.tick();
+    }
+    EXPECT_EQ(result, NodeResult::SUCCESS);
+    EXPECT_EQ(server_->getRequestCount(), 2u);
+    EXPECT_EQ(client_->getPendingCount(), 0u);
+}
+
+// The requests of a tick go out in a single write.
+TEST_F(RemoteActionTest, BatchesRequestsOfATick) {
+    std::vector<std::shared_ptr<RemoteActionNode>> nodes;
+    for (int node = 0; node < 8; ++node) {
+        nodes.push_back(std::make_shared<RemoteActionNode>("node", client_, "echo", std::to_string(node)));
+        EXPECT_EQ(nodes.back()->tick(), NodeResult::RUNNING);
+    }
+    EXPECT_EQ(client_->getWriteCount(), 0u);
+    client_->flush();
+    EXPECT_EQ(client_->getWriteCount(), 1u);
+
+    const auto results = tickUntilDone(nodes);
+    EXPECT_THAT(results, Each(NodeResult::SUCCESS));
+    for (int node = 0; node < 8; ++node) {
+        EXPECT_EQ(nodes[node]->getOutput(), std::to_string(node));
+    }
+    EXPECT_EQ(server_->getRequestCount(), 8u);
+    EXPECT_EQ(server_->getReadCount(), 1u);
+}
+
+// Responses are matched to their requests whatever the order they arrive in.
+TEST_F(RemoteActionTest, OutOfOrderResponses) {
+    auto slow = std::make_shared<RemoteActionNode>("slow", client_, "slow", "first");
+    auto fast = std::make_shared<RemoteActionNode>("fast", client_, "echo", "second");
+    EXPECT_EQ(slow->tick(), NodeResult::RUNNING);
+    EXPECT_EQ(fast->tick(), NodeResult::RUNNING);
+    client_->flush();
+
+    NodeResult fast_result = NodeResult::RUNNING;
+    while (fast_result == NodeResult::RUNNING) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        client_->poll();
+        fast_result = fast->tick();
+        if (fast_result == NodeResult::RUNNING) {
+            EXPECT_EQ(slow->tick(), NodeResult::RUNNING);
+        }
+    }
+    EXPECT_EQ(fast_result, NodeResult::SUCCESS);
+    EXPECT_EQ(fast->getOutput(), "second");
+    EXPECT_EQ(slow->tick(), NodeResult::RUNNING);
+    EXPECT_THAT(tickUntilDone({slow}), ElementsAre(NodeResult::SUCCESS));
+    EXPECT_EQ(slow->getOutput(), "slow first");
+}
+
+// Registered as a tick observer, the client polls and flushes around every tick of the tree.
+TEST_F(RemoteActionTest, BTManagerIntegration) {
+    BTManager manager;
+    manager.addTickObserver(client_);
+    auto first = manager.makeNode<RemoteActionNode>("first", client_, "echo", "a");
+    auto second = manager.makeNode<RemoteActionNode>("second", client_, "echo", "b");
+    manager.makeNode<SequenceNode>("root", std::vector<std::shared_ptr<NodeInterface>>{first, second});
+
+    // The tree never blocks: it keeps ticking while the requests are in flight.
+    EXPECT_EQ(manager.run(100'000'000), NodeResult::SUCCESS);
+    EXPECT_GT(manager.getLastTickCount(), 2u);
+    EXPECT_EQ(first->getOutput(), "a");
+    EXPECT_EQ(second->getOutput(), "b");
+    EXPECT_EQ(server_->getRequestCount(), 2u);
+    // One write per tick that issued a request.
+    EXPECT_EQ(client_->getWriteCount(), 2u);
+}
+
+// A node that throws skips the afterTick of its ancestors; the next tick of the root polls and
+// flushes anyway.
+TEST_F(RemoteActionTest, RecoversFromThrowingNode) {
+    BTManager manager;
+    manager.addTickObserver(client_);
+    auto thrower = manager.makeNode<ThrowOnceNode>("thrower");
+    auto echo = manager.makeNode<RemoteActionNode>("echo", client_, "echo", "a");
+    manager.makeNode<SequenceNode>("root", std::vector<std::shared_ptr<NodeInterface>>{thrower, echo});
+
+    EXPECT_THROW(manager.run(1), std::runtime_error);
+    EXPECT_EQ(manager.run(100'000'000), NodeResult::SUCCESS);
+    EXPECT_EQ(echo->getOutput(), "a");
+    EXPECT_EQ(client_->getWriteCount(), 1u);
+}
+
+// When the connection is lost, pending and later requests fail.
+TEST_F(RemoteActionTest, ServerDisconnect) {
+    auto slow = std::make_shared<RemoteActionNode>("slow", client_, "slow", "lost");
+    EXPECT_EQ(slow->tick(), NodeResult::RUNNING);
+    client_->flush();
+    while (server_->getRequestCount() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    server_->disconnectClients();
+
+    EXPECT_THAT(tickUntilDone({slow}), ElementsAre(NodeResult::FAILURE));
+    EXPECT_FALSE(client_->isConnected());
+    EXPECT_EQ(client_->getPendingCount(), 0u);
+    EXPECT_EQ(slow->tick(), NodeResult::FAILURE);
+}
+
+// Connecting to a missing server fails right away.
+TEST_F(RemoteActionTest, MissingServer) {
+    EXPECT_THROW(RemoteActionClient("/tmp/bt_remote_action_test_missing.sock"), std::runtime_error);
+    EXPECT_THROW(RemoteActionNode("node", nullptr, "echo"), std::invalid_argument);
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
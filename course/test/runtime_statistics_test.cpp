@@ -0,0 +1,234 @@
+/**
+ * @file runtime_statistics_test.cpp
+ * @brief Tests for the RuntimeStatistics and the MetricsExporter.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// System includes
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/MetricsExporter.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/RuntimeStatistics.hpp"
+
+// Testing
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+class ChildNodeMock : public NodeInterface {
+   public:
+    explicit ChildNodeMock(const std::string& name) : NodeInterface(name) {}
+    MOCK_METHOD0(tick, NodeResult());
+};
+
+// Leaf that writes into the blackboard on every tick.
+class WriterNode : public NodeInterface {
+   public:
+    WriterNode(const std::string& name, std::shared_ptr<Blackboard> blackboard)
+        : NodeInterface(name), blackboard_{blackboard} {}
+    NodeResult tick() override {
+        blackboard_->set(getNameRef(), Any(++count_));
+        return NodeResult::SUCCESS;
+    }
+
+   private:
+    std::shared_ptr<Blackboard> blackboard_;
+    int count_ = 0;
+};
+
+// Sends an HTTP request through a connected socket and returns the whole response.
+std::string request(int fd) {
+    const std::string get = "GET /metrics HTTP/1.0\r\n\r\n";
+    EXPECT_EQ(::send(fd, get.data(), get.size(), 0), static_cast<ssize_t>(get.size()));
+    std::string response;
+    char buffer[1024];
+    ssize_t bytes;
+    while ((bytes = ::recv(fd, buffer, sizeof(buffer), 0)) > 0) {
+        response.append(buffer, static_cast<size_t>(bytes));
+    }
+    ::close(fd);
+    return response;
+}
+
+class RuntimeStatisticsTest : public Test {
+   public:
+};
+
+// The snapshot reflects ticks, runs, nodes and blackboard writes.
+TEST_F(RuntimeStatisticsTest, SnapshotCounters) {
+    BTManager uut_;
+    auto statistics = uut_.enableStatistics();
+    EXPECT_EQ(statistics, uut_.enableStatistics());
+
+    auto writer = uut_.makeNode<WriterNode>("writer", uut_.getBlackboard());
+    auto leaf = uut_.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick())
+        .WillOnce(Return(NodeResult::RUNNING))
+        .WillOnce(Return(NodeResult::SUCCESS))
+        .WillRepeatedly(Return(NodeResult::RUNNING));
+    uut_.makeNode<SequenceNode>("root", std::vector<std::shared_ptr<NodeInterface>>{writer, leaf});
+
+    EXPECT_EQ(uut_.run(10), NodeResult::SUCCESS);
+    EXPECT_EQ(uut_.run(2), NodeResult::FAILURE);
+
+    const auto snapshot = statistics->snapshot();
+    EXPECT_EQ(snapshot.total_ticks, 5u);
+    EXPECT_EQ(snapshot.runs_success, 1u);
+    EXPECT_EQ(snapshot.runs_failure, 0u);
+    EXPECT_EQ(snapshot.runs_tick_limit, 1u);
+    EXPECT_EQ(snapshot.blackboard_size, 1u);
+    EXPECT_EQ(snapshot.blackboard_writes, 2u);
+    EXPECT_LE(snapshot.latency_p50_ns, snapshot.latency_p90_ns);
+    EXPECT_LE(snapshot.latency_p90_ns, snapshot.latency_p99_ns);
+    EXPECT_LE(snapshot.latency_p99_ns, snapshot.latency_max_ns);
+    EXPECT_GT(snapshot.latency_max_ns, 0.0);
+    EXPECT_GT(snapshot.latency_sum_ns, 0u);
+    ASSERT_EQ(snapshot.node_hits.size(), 3u);
+    EXPECT_EQ(snapshot.node_hits[writer->getId()].name, "writer");
+    EXPECT_EQ(snapshot.node_hits[writer->getId()].ticks, 2u);
+    EXPECT_EQ(snapshot.node_hits[leaf->getId()].ticks, 3u);
+    EXPECT_EQ(snapshot.node_hits[2].ticks, 5u);
+}
+
+// A tick cut short by a node that throws isn't counted, and the following ones are.
+TEST_F(RuntimeStatisticsTest, ThrowingNode) {
+    BTManager uut_;
+    auto statistics = uut_.enableStatistics();
+    auto thrower = uut_.makeNode<ChildNodeMock>("thrower");
+    auto leaf = uut_.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*thrower, tick())
+        .WillOnce(Throw(std::runtime_error("first tick")))
+        .WillRepeatedly(Return(NodeResult::SUCCESS));
+    EXPECT_CALL(*leaf, tick()).WillRepeatedly(Return(NodeResult::SUCCESS));
+    uut_.makeNode<SequenceNode>("root", std::vector<std::shared_ptr<NodeInterface>>{thrower, leaf});
+
+    EXPECT_THROW(uut_.run(10), std::runtime_error);
+    EXPECT_EQ(statistics->snapshot().total_ticks, 0u);
+    EXPECT_EQ(uut_.run(10), NodeResult::SUCCESS);
+    const auto snapshot = statistics->snapshot();
+    EXPECT_EQ(snapshot.total_ticks, 2u);
+    EXPECT_GT(snapshot.latency_max_ns, 0.0);
+}
+
+// Snapshots can be taken from another thread while the tree is running.
+TEST_F(RuntimeStatisticsTest, ConcurrentSnapshot) {
+    BTManager uut_;
+    auto statistics = uut_.enableStatistics();
+    auto writer = uut_.makeNode<WriterNode>("writer", uut_.getBlackboard());
+
+    std::atomic<bool> done{false};
+    std::thread reader([&]() {
+        uint64_t last_ticks = 0;
+        while (!done.load()) {
+            const auto snapshot = statistics->snapshot();
+            EXPECT_GE(snapshot.total_ticks, last_ticks);
+            last_ticks = snapshot.total_ticks;
+        }
+    });
+    for (int i = 0; i < 10000; ++i) {
+        uut_.run(2);
+    }
+    done.store(true);
+    reader.join();
+
+    EXPECT_EQ(statistics->snapshot().total_ticks, 10000u);
+}
+
+// The Prometheus format holds every metric.
+TEST_F(RuntimeStatisticsTest, PrometheusFormat) {
+    RuntimeStatistics::Snapshot snapshot;
+    snapshot.total_ticks = 42;
+    snapshot.latency_sum_ns = 1500000000;
+    snapshot.runs_success = 3;
+    snapshot.node_hits.emplace_back(RuntimeStatistics::NodeHits{"quoted\"node", 7});
+
+    const std::string text = MetricsExporter::formatPrometheus(snapshot);
+
+    EXPECT_THAT(text, HasSubstr("bt_ticks_total 42\n"));
+    EXPECT_THAT(text, HasSubstr("bt_runs_total{result=\"success\"} 3\n"));
+    EXPECT_THAT(text, HasSubstr("bt_tick_latency_seconds{quantile=\"0.99\"}"));
+    EXPECT_THAT(text, HasSubstr("bt_tick_latency_seconds_sum 1.5\n"));
+    EXPECT_THAT(text, HasSubstr("bt_tick_latency_seconds_count 42\n"));
+    EXPECT_THAT(text, HasSubstr("bt_blackboard_writes_per_second"));
+    EXPECT_THAT(text, HasSubstr("bt_node_ticks_total{node=\"quoted\\\"node\"} 7\n"));
+}
+
+// The metrics are served over a Unix domain socket.
+TEST_F(RuntimeStatisticsTest, ExporterUnixSocket) {
+    BTManager uut_;
+    auto statistics = uut_.enableStatistics();
+    uut_.makeNode<WriterNode>("writer", uut_.getBlackboard());
+    uut_.run(2);
+
+    MetricsExporter exporter(statistics);
+    const std::string path = "/tmp/bt_metrics_test_" + std::to_string(::getpid()) + ".sock";
+    exporter.listenUnix(path);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+
+    const std::string response = request(fd);
+    EXPECT_THAT(response, StartsWith("HTTP/1.0 200 OK"));
+    EXPECT_THAT(response, HasSubstr("bt_ticks_total 1\n"));
+    EXPECT_THAT(response, HasSubstr("bt_node_ticks_total{node=\"writer\"} 1\n"));
+
+    exporter.stop();
+    EXPECT_NE(::access(path.c_str(), F_OK), 0);
+}
+
+// The metrics are served over a local TCP port.
+TEST_F(RuntimeStatisticsTest, ExporterTcpPort) {
+    BTManager uut_;
+    MetricsExporter exporter(uut_.enableStatistics());
+    const uint16_t port = exporter.listenTcp(0);
+    EXPECT_THROW({ exporter.listenTcp(0); }, std::runtime_error);
+
+    const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+
+    EXPECT_THAT(request(fd), HasSubstr("bt_ticks_total 0\n"));
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
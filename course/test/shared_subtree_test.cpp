@@ -0,0 +1,170 @@
+/**
+ * @file shared_subtree_test.cpp
+ * @brief Tests for SharedSubtree and SubtreeInstanceNode.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/NodeInterface.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/Nodes/SubtreeInstanceNode.hpp"
+#include "BehaviorTree/SharedSubtree.hpp"
+#include "BehaviorTree/TreeGenerator.hpp"
+
+// Testing
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+class LeafNodeMock : public NodeInterface {
+   public:
+    LeafNodeMock() : NodeInterface("mocked_node") {}
+    MOCK_METHOD0(tick, NodeResult());
+};
+
+// Checks that the builder only accepts trees.
+TEST(SharedSubtreeTest, BuilderRejectsInvalidStructures) {
+    SharedSubtree::Builder builder;
+    EXPECT_THROW(builder.addLeaf(nullptr), std::invalid_argument);
+    EXPECT_THROW(builder.addSequence({0}), std::invalid_argument);
+    EXPECT_THROW(builder.build(0), std::invalid_argument);
+
+    const auto leaf = builder.addLeaf(std::make_shared<LeafNodeMock>());
+    const auto negation = builder.addNegation(leaf);
+    // A node cannot have two parents, nor be the root when it has one.
+    EXPECT_THROW(builder.addFallback({leaf}), std::invalid_argument);
+    EXPECT_THROW(builder.build(leaf), std::invalid_argument);
+
+    const auto subtree = builder.build(negation);
+    EXPECT_EQ(2u, subtree->getNodeCount());
+    EXPECT_EQ(0u, subtree->getStateSize());
+    EXPECT_THROW({ SubtreeInstanceNode uut_("node", nullptr); }, std::invalid_argument);
+}
+
+// Checks that each instance keeps its own position in the shared structure.
+TEST(SharedSubtreeTest, InstancesKeepTheirOwnState) {
+    auto first_leaf = std::make_shared<LeafNodeMock>();
+    auto second_leaf = std::make_shared<LeafNodeMock>();
+    SharedSubtree::Builder builder;
+    const auto first = builder.addLeaf(first_leaf);
+    const auto second = builder.addLeaf(second_leaf);
+    const auto subtree = builder.build(builder.addSequence({first, second}));
+    EXPECT_EQ(1u, subtree->getStateSize());
+
+    SubtreeInstanceNode uut_a("a", subtree);
+    SubtreeInstanceNode uut_b("b", subtree);
+    {
+        InSequence ticks;
+        EXPECT_CALL(*first_leaf, tick()).WillOnce(Return(NodeResult::SUCCESS));
+        EXPECT_CALL(*first_leaf, tick()).WillOnce(Return(NodeResult::SUCCESS));
+        EXPECT_CALL(*second_leaf, tick()).WillOnce(Return(NodeResult::SUCCESS));
+        EXPECT_CALL(*second_leaf, tick()).WillOnce(Return(NodeResult::RUNNING));
+    }
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_a.tick());
+    // b starts from the first child even though a already moved to the second one.
+    EXPECT_EQ(NodeResult::RUNNING, uut_b.tick());
+    EXPECT_EQ(NodeResult::SUCCESS, uut_a.tick());
+    EXPECT_EQ(NodeResult::RUNNING, uut_b.tick());
+}
+
+// Checks that a halted instance starts over from the first child.
+TEST(SharedSubtreeTest, HaltRestartsTheInstance) {
+    auto first_leaf = std::make_shared<LeafNodeMock>();
+    auto second_leaf = std::make_shared<LeafNodeMock>();
+    SharedSubtree::Builder builder;
+    const auto first = builder.addLeaf(first_leaf);
+    const auto second = builder.addLeaf(second_leaf);
+    SubtreeInstanceNode uut_("node", builder.build(builder.addSequence({first, second})));
+    {
+        InSequence ticks;
+        EXPECT_CALL(*first_leaf, tick()).WillOnce(Return(NodeResult::SUCCESS));
+        EXPECT_CALL(*second_leaf, tick()).WillOnce(Return(NodeResult::RUNNING));
+        EXPECT_CALL(*first_leaf, tick()).WillOnce(Return(NodeResult::SUCCESS));
+    }
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    uut_.halt();
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+}
+
+// Builds Fallback(Sequence(leaf, leaf), Negation(leaf), Sequence(leaf, leaf)) both as nodes and
+// as a shared structure, with leaves seeded alike, and compares their results.
+void compareWithNodes(TickMode mode) {
+    auto leaf = [](uint64_t seed) { return std::make_shared<RandomLeafNode>("leaf", seed, 0.4, 0.4); };
+    const std::vector<uint64_t> seeds{1, 2, 3, 4, 5};
+
+    auto first = std::make_shared<SequenceNode>(
+        "first", std::vector<std::shared_ptr<NodeInterface>>{leaf(seeds[0]), leaf(seeds[1])}, mode);
+    auto negation = std::make_shared<NegationNode>("negation", leaf(seeds[2]));
+    auto last = std::make_shared<SequenceNode>(
+        "last", std::vector<std::shared_ptr<NodeInterface>>{leaf(seeds[3]), leaf(seeds[4])}, mode);
+    FallbackNode nodes("root", {first, negation, last}, mode);
+
+    SharedSubtree::Builder builder;
+    std::vector<SharedSubtree::Index> leaves;
+    for (const auto seed : seeds) {
+        leaves.emplace_back(builder.addLeaf(leaf(seed)));
+    }
+    const auto shared_first = builder.addSequence({leaves[0], leaves[1]});
+    const auto shared_negation = builder.addNegation(leaves[2]);
+    const auto shared_last = builder.addSequence({leaves[3], leaves[4]});
+    const auto subtree = builder.build(builder.addFallback({shared_first, shared_negation, shared_last}));
+    EXPECT_EQ(3u, subtree->getStateSize());
+    SubtreeInstanceNode instance("instance", subtree, mode);
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(nodes.tick(), instance.tick()) << "tick " << i;
+    }
+}
+
+TEST(SharedSubtreeTest, BehavesAsTheEquivalentNodesInStepMode) { compareWithNodes(TickMode::STEP); }
+
+TEST(SharedSubtreeTest, BehavesAsTheEquivalentNodesInEagerMode) { compareWithNodes(TickMode::EAGER); }
+
+// Checks that reset restarts the subtree.
+TEST(SharedSubtreeTest, ResetRestartsTheSubtree) {
+    auto first_leaf = std::make_shared<LeafNodeMock>();
+    auto second_leaf = std::make_shared<LeafNodeMock>();
+    SharedSubtree::Builder builder;
+    const auto first = builder.addLeaf(first_leaf);
+    const auto second = builder.addLeaf(second_leaf);
+    SubtreeInstanceNode uut_("node", builder.build(builder.addFallback({first, second})));
+    EXPECT_CALL(*first_leaf, tick()).Times(2).WillRepeatedly(Return(NodeResult::FAILURE));
+    EXPECT_CALL(*second_leaf, tick()).Times(0);
+
+    // Test
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+    uut_.reset();
+    EXPECT_EQ(NodeResult::RUNNING, uut_.tick());
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+/**
+ * @file tick_stream_test.cpp
+ * @brief Tests for the shared-memory tick stream.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// System includes
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/TickStream.hpp"
+
+// Testing
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+class ChildNodeMock : public NodeInterface {
+   public:
+    explicit ChildNodeMock(const std::string& name) : NodeInterface(name) {}
+    MOCK_METHOD0(tick, NodeResult());
+};
+
+class TickStreamTest : public Test {
+   public:
+    TickStreamTest() : name_{"/bt_tick_stream_test_" + std::to_string(::getpid())} {}
+
+    std::string name_;
+};
+
+// The reader gets every tick of every node, in order, with the node names.
+TEST_F(TickStreamTest, PublishAndRead) {
+    BTManager manager;
+    auto publisher = std::make_shared<TickStreamPublisher>(name_, 64);
+    manager.addTickObserver(publisher);
+    TickStreamReader reader(name_);
+
+    auto leaf = manager.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick()).WillOnce(Return(NodeResult::RUNNING)).WillOnce(Return(NodeResult::FAILURE));
+    auto negation = manager.makeNode<NegationNode>("negation", leaf);
+    EXPECT_EQ(manager.run(10), NodeResult::SUCCESS);
+
+    std::vector<TickRecord> records;
+    ASSERT_EQ(reader.poll(records), 4u);
+    EXPECT_EQ(reader.getLostRecords(), 0u);
+    EXPECT_EQ(reader.getNodeName(leaf->getId()), "leaf");
+    EXPECT_EQ(reader.getNodeName(negation->getId()), "negation");
+
+    // Children are recorded before their parent, within the same tick.
+    EXPECT_EQ(records[0].tick, 1u);
+    EXPECT_EQ(records[0].node_id, leaf->getId());
+    EXPECT_EQ(records[0].result, NodeResult::RUNNING);
+    EXPECT_EQ(records[0].depth, 1u);
+    EXPECT_EQ(records[1].tick, 1u);
+    EXPECT_EQ(records[1].node_id, negation->getId());
+    EXPECT_EQ(records[1].depth, 0u);
+    EXPECT_EQ(records[3].tick, 2u);
+    EXPECT_EQ(records[3].result, NodeResult::SUCCESS);
+    EXPECT_LE(records[0].timestamp_ns, records[3].timestamp_ns);
+
+    // Nothing new to read.
+    EXPECT_EQ(reader.poll(records), 0u);
+}
+
+// A tick cut short by a node that throws doesn't shift the ticks and depths of the next ones.
+TEST_F(TickStreamTest, ThrowingNode) {
+    BTManager manager;
+    auto publisher = std::make_shared<TickStreamPublisher>(name_, 64);
+    manager.addTickObserver(publisher);
+    TickStreamReader reader(name_);
+
+    auto leaf = manager.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick())
+        .WillOnce(Throw(std::runtime_error("first tick")))
+        .WillOnce(Return(NodeResult::FAILURE));
+    auto negation = manager.makeNode<NegationNode>("negation", leaf);
+    EXPECT_THROW(manager.run(10), std::runtime_error);
+    EXPECT_EQ(manager.run(10), NodeResult::SUCCESS);
+
+    std::vector<TickRecord> records;
+    ASSERT_EQ(reader.poll(records), 2u);
+    EXPECT_EQ(records[0].tick, 2u);
+    EXPECT_EQ(records[0].node_id, leaf->getId());
+    EXPECT_EQ(records[0].depth, 1u);
+    EXPECT_EQ(records[1].tick, 2u);
+    EXPECT_EQ(records[1].node_id, negation->getId());
+    EXPECT_EQ(records[1].depth, 0u);
+}
+
+// A reader that falls behind loses the oldest records, the publisher never waits.
+TEST_F(TickStreamTest, SlowReaderLosesOldestRecords) {
+    BTManager manager;
+    auto publisher = std::make_shared<TickStreamPublisher>(name_, 5);
+    manager.addTickObserver(publisher);
+    TickStreamReader reader(name_);
+
+    auto leaf = manager.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick()).WillRepeatedly(Return(NodeResult::RUNNING));
+    manager.run(20);
+
+    // The capacity is rounded up to 8.
+    std::vector<TickRecord> records;
+    EXPECT_EQ(reader.poll(records), 8u);
+    EXPECT_EQ(reader.getLostRecords(), 12u);
+    EXPECT_EQ(records.front().tick, 13u);
+    EXPECT_EQ(records.back().tick, 20u);
+}
+
+// Another process reads the stream.
+TEST_F(TickStreamTest, ReadFromAnotherProcess) {
+    BTManager manager;
+    auto publisher = std::make_shared<TickStreamPublisher>(name_, 64);
+    manager.addTickObserver(publisher);
+    auto leaf = manager.makeNode<ChildNodeMock>("leaf");
+    EXPECT_CALL(*leaf, tick()).WillRepeatedly(Return(NodeResult::RUNNING));
+    manager.run(3);
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        TickStreamReader reader(name_, true);
+        std::vector<TickRecord> records;
+        const bool ok = (reader.poll(records) == 3) && (reader.getNodeName(0) == "leaf");
+        ::_exit(ok ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+// Attaching to a missing stream fails.
+TEST_F(TickStreamTest, MissingStream) {
+    EXPECT_THROW({ TickStreamReader reader(name_ + "_missing"); }, std::runtime_error);
+    EXPECT_THROW({ TickStreamPublisher publisher(name_, 0); }, std::invalid_argument);
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
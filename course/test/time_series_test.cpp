@@ -0,0 +1,193 @@
+/**
+ * @file time_series_test.cpp
+ * @brief Tests of the time-series blackboard entries.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/TimeSeries.hpp"
+
+// Testing
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+using TimePoint = Clock::TimePoint;
+
+TimePoint at(int64_t milliseconds) { return TimePoint{} + std::chrono::milliseconds(milliseconds); }
+
+std::vector<int> values(const TimeSeries<int>& time_series, size_t count) {
+    std::vector<int> result;
+    time_series.visitLatest(count,
+                            [&result](const TimeSeries<int>::Sample& sample) { result.push_back(sample.value); });
+    return result;
+}
+
+TEST(TimeSeriesTest, Constructor) {
+    EXPECT_THROW(TimeSeries<int>(0), std::invalid_argument);
+    TimeSeries<int> time_series(4);
+    EXPECT_EQ(time_series.capacity(), 4u);
+    EXPECT_EQ(time_series.size(), 0u);
+    TimeSeries<int>::Sample sample;
+    EXPECT_FALSE(time_series.latest(sample));
+    EXPECT_THAT(values(time_series, 4), IsEmpty());
+}
+
+// The oldest samples are overwritten once it is full.
+TEST(TimeSeriesTest, LatestSamples) {
+    TimeSeries<int> time_series(4);
+    for (int value = 1; value <= 6; ++value) {
+        time_series.append(value, at(value));
+    }
+    EXPECT_EQ(time_series.size(), 4u);
+    EXPECT_EQ(time_series.getAppendCount(), 6u);
+
+    TimeSeries<int>::Sample sample;
+    ASSERT_TRUE(time_series.latest(sample));
+    EXPECT_EQ(sample.value, 6);
+    EXPECT_EQ(sample.timestamp, at(6));
+    EXPECT_THAT(values(time_series, 2), ElementsAre(5, 6));
+    EXPECT_THAT(values(time_series, 10), ElementsAre(3, 4, 5, 6));
+
+    TimeSeries<int>::Sample samples[3];
+    ASSERT_EQ(time_series.latest(3, samples), 3u);
+    EXPECT_EQ(samples[0].value, 4);
+    EXPECT_EQ(samples[2].timestamp, at(6));
+
+    EXPECT_THROW(time_series.append(7, at(5)), std::invalid_argument);
+}
+
+TEST(TimeSeriesTest, Windows) {
+    TimeSeries<double> time_series(8);
+    for (int value = 0; value < 12; ++value) {
+        time_series.append(value * 10.0, at(value));
+    }
+    std::vector<double> window;
+    const size_t visited = time_series.visitWindow(
+        at(5), at(7), [&window](const TimeSeries<double>::Sample& sample) { window.push_back(sample.value); });
+    EXPECT_EQ(visited, 3u);
+    EXPECT_THAT(window, ElementsAre(50.0, 60.0, 70.0));
+
+    // Only the samples still kept are visited.
+    const TimeSeriesSummary all = time_series.summarizeWindow(at(0), at(100));
+    EXPECT_EQ(all.count, 8u);
+    EXPECT_DOUBLE_EQ(all.min, 40.0);
+    EXPECT_DOUBLE_EQ(all.max, 110.0);
+    EXPECT_DOUBLE_EQ(all.mean, 75.0);
+
+    EXPECT_EQ(time_series.summarizeWindow(at(20), at(30)).count, 0u);
+    const TimeSeriesSummary latest = time_series.summarizeLatest(2);
+    EXPECT_EQ(latest.count, 2u);
+    EXPECT_DOUBLE_EQ(latest.sum, 210.0);
+    EXPECT_DOUBLE_EQ(latest.mean, 105.0);
+}
+
+// The writer keeps the entry and appends to it, readers find it through the blackboard.
+TEST(TimeSeriesTest, BlackboardEntry) {
+    Blackboard blackboard;
+    auto poses = blackboard.registerTimeSeries<double>("poses", 16);
+    EXPECT_EQ(blackboard.registerTimeSeries<double>("poses", 32), poses);
+    EXPECT_EQ(poses->capacity(), 16u);
+    const uint64_t writes = blackboard.getWriteCount();
+
+    poses->append(1.5, at(1));
+    poses->append(2.5, at(2));
+    EXPECT_EQ(blackboard.getWriteCount(), writes);
+
+    const TimeSeries<double>* reader = blackboard.tryGetTimeSeries<double>("poses");
+    ASSERT_EQ(reader, poses.get());
+    EXPECT_DOUBLE_EQ(reader->summarizeLatest(2).mean, 2.0);
+    EXPECT_EQ(blackboard.tryGetTimeSeries<int>("poses"), nullptr);
+    EXPECT_EQ(blackboard.tryGetTimeSeries<double>("missing"), nullptr);
+}
+
+// Readers never see a torn sample nor samples out of order while the writer wraps around.
+TEST(TimeSeriesTest, ConcurrentWriter) {
+    struct Pose {
+        int64_t x;
+        int64_t y;
+        int64_t z;
+    };
+    TimeSeries<Pose> time_series(8);
+    constexpr int64_t kSamples = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]() {
+        for (int64_t sample = 0; sample < kSamples; ++sample) {
+            time_series.append(Pose{sample, 2 * sample, 3 * sample}, at(sample));
+        }
+        done.store(true);
+    });
+
+    uint64_t checked = 0;
+    bool consistent = true;
+    while (!done.load()) {
+        int64_t previous = -1;
+        time_series.visitLatest(8, [&](const TimeSeries<Pose>::Sample& sample) {
+            const int64_t x = sample.value.x;
+            consistent = consistent && (sample.value.y == 2 * x) && (sample.value.z == 3 * x) &&
+                         (sample.timestamp == at(x)) && (x > previous);
+            previous = x;
+            ++checked;
+        });
+    }
+    writer.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_GT(checked, 0u);
+    TimeSeries<Pose>::Sample last;
+    ASSERT_TRUE(time_series.latest(last));
+    EXPECT_EQ(last.value.x, kSamples - 1);
+}
+
+// Aggregates read the samples in place, they only keep the ones that weren't overwritten.
+TEST(TimeSeriesTest, ConcurrentAggregates) {
+    TimeSeries<double> time_series(64);
+    constexpr int64_t kSamples = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]() {
+        for (int64_t sample = 0; sample < kSamples; ++sample) {
+            time_series.append(static_cast<double>(sample), at(sample));
+        }
+        done.store(true);
+    });
+
+    bool consistent = true;
+    while (!done.load()) {
+        // The samples kept are consecutive, so they are fully described by min and max.
+        const TimeSeriesSummary summary = time_series.summarizeLatest(64);
+        if (summary.count > 0) {
+            consistent = consistent && (summary.max - summary.min == static_cast<double>(summary.count - 1)) &&
+                         (summary.mean == (summary.max + summary.min) / 2.0);
+        }
+    }
+    writer.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_DOUBLE_EQ(time_series.summarizeLatest(64).max, static_cast<double>(kSamples - 1));
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+/**
+ * @file tree_generator_test.cpp
+ * @brief Tests for the TreeGenerator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <cstdint>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TreeGenerator.hpp"
+
+// Testing
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+class TreeGeneratorTest : public Test {
+   public:
+    // Runs the tree several times and returns the results and ticks used.
+    static std::vector<uint32_t> runTrace(BTManager& manager) {
+        std::vector<uint32_t> trace;
+        for (int i = 0; i < 20; ++i) {
+            trace.emplace_back(static_cast<uint32_t>(manager.run(50)));
+            trace.emplace_back(manager.getLastTickCount());
+        }
+        return trace;
+    }
+};
+
+// The same seed produces the same tree and the same results.
+TEST_F(TreeGeneratorTest, Reproducible) {
+    TreeGeneratorConfig config;
+    config.seed = 1234;
+    config.depth = 5;
+
+    BTManager manager_1;
+    BTManager manager_2;
+    const auto info_1 = TreeGenerator(config).generate(manager_1);
+    const auto info_2 = TreeGenerator(config).generate(manager_2);
+
+    EXPECT_EQ(info_1.nodes, info_2.nodes);
+    EXPECT_EQ(info_1.leaves, info_2.leaves);
+    EXPECT_EQ(info_1.sequences, info_2.sequences);
+    EXPECT_EQ(info_1.fallbacks, info_2.fallbacks);
+    EXPECT_EQ(info_1.negations, info_2.negations);
+    EXPECT_EQ(runTrace(manager_1), runTrace(manager_2));
+
+    config.seed = 4321;
+    BTManager manager_3;
+    const auto info_3 = TreeGenerator(config).generate(manager_3);
+    EXPECT_NE(info_1.nodes, info_3.nodes);
+}
+
+// A fixed fanout without negations produces a full tree, with the root as root of the manager.
+TEST_F(TreeGeneratorTest, FullTreeShape) {
+    TreeGeneratorConfig config;
+    config.depth = 4;
+    config.min_fanout = 3;
+    config.max_fanout = 3;
+    config.negation_weight = 0.0;
+
+    BTManager manager;
+    const auto info = TreeGenerator(config).generate(manager);
+
+    EXPECT_EQ(info.leaves, 81u);
+    EXPECT_EQ(info.nodes, 1u + 3u + 9u + 27u + 81u);
+    EXPECT_EQ(info.sequences + info.fallbacks, 40u);
+    EXPECT_EQ(info.negations, 0u);
+    EXPECT_EQ(info.root->getId(), info.nodes - 1);
+}
+
+// The node limit turns the rest of the tree into leaves.
+TEST_F(TreeGeneratorTest, NodeLimit) {
+    TreeGeneratorConfig config;
+    config.depth = 12;
+    config.min_fanout = 4;
+    config.max_fanout = 4;
+    config.max_nodes = 1000;
+
+    BTManager manager;
+    const auto info = TreeGenerator(config).generate(manager);
+
+    EXPECT_GE(info.nodes, 1000u);
+    EXPECT_LE(info.nodes, 1000u + 12u * 4u);
+}
+
+// Leaves follow the configured distribution.
+TEST_F(TreeGeneratorTest, LeafDistribution) {
+    RandomLeafNode leaf("leaf", 42, 0.5, 0.3);
+    uint32_t counts[3] = {0, 0, 0};
+    constexpr uint32_t kTicks = 100000;
+    for (uint32_t i = 0; i < kTicks; ++i) {
+        ++counts[static_cast<int>(leaf.tick())];
+    }
+    EXPECT_NEAR(counts[static_cast<int>(NodeResult::SUCCESS)] / double(kTicks), 0.5, 0.01);
+    EXPECT_NEAR(counts[static_cast<int>(NodeResult::FAILURE)] / double(kTicks), 0.3, 0.01);
+    EXPECT_NEAR(counts[static_cast<int>(NodeResult::RUNNING)] / double(kTicks), 0.2, 0.01);
+}
+
+// Invalid configurations are rejected.
+TEST_F(TreeGeneratorTest, InvalidConfig) {
+    TreeGeneratorConfig config;
+    config.min_fanout = 5;
+    config.max_fanout = 2;
+    EXPECT_THROW({ TreeGenerator generator(config); }, std::invalid_argument);
+
+    config = TreeGeneratorConfig();
+    config.sequence_weight = 0.0;
+    config.fallback_weight = 0.0;
+    config.negation_weight = 0.0;
+    EXPECT_THROW({ TreeGenerator generator(config); }, std::invalid_argument);
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,160 @@
+/**
+ * @file tree_reloader_test.cpp
+ * @brief Tests for the hot-reload of trees through the TreeReloader.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/NodeFactory.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/TreeDescription.hpp"
+#include "BehaviorTree/TreeReloader.hpp"
+
+// Testing
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+// Leaf that returns RUNNING until it was ticked `ticks` times, then SUCCESS.
+class CounterNode : public NodeInterface {
+   public:
+    CounterNode(const std::string& name, uint32_t ticks) : NodeInterface(name), ticks_{ticks} {}
+    NodeResult tick() override { return (++count_ >= ticks_) ? NodeResult::SUCCESS : NodeResult::RUNNING; }
+    uint32_t count_ = 0;
+
+   private:
+    uint32_t ticks_;
+};
+
+class TreeReloaderTest : public Test {
+   public:
+    TreeReloaderTest() {
+        factory_.registerBuilder("Counter", [this](const NodeDescription& description,
+                                                   std::vector<std::shared_ptr<NodeInterface>> children) {
+            (void)children;
+            std::this_thread::sleep_for(build_delay_);
+            const auto ticks = static_cast<uint32_t>(std::stoul(description.parameters.at("ticks")));
+            auto node = std::make_shared<CounterNode>(description.name, ticks);
+            counters_.emplace_back(node);
+            return node;
+        });
+    }
+
+    static NodeDescription counter(const std::string& name, uint32_t ticks) {
+        return NodeDescription{"Counter", name, {{"ticks", std::to_string(ticks)}}, {}};
+    }
+
+    NodeFactory factory_;
+    std::chrono::milliseconds build_delay_{0};
+    std::vector<std::shared_ptr<CounterNode>> counters_;
+};
+
+// Equal subtrees hash equally, any change changes the hash.
+TEST_F(TreeReloaderTest, StructuralHash) {
+    const NodeDescription tree{"Sequence", "root", {}, {counter("a", 1), counter("b", 2)}};
+    NodeDescription copy = tree;
+    EXPECT_EQ(structuralHash(tree), structuralHash(copy));
+
+    copy.children[1].parameters["ticks"] = "3";
+    EXPECT_NE(structuralHash(tree), structuralHash(copy));
+    EXPECT_NE(structuralHash(NodeDescription{"ab", "c", {}, {}}), structuralHash(NodeDescription{"a", "bc", {}, {}}));
+}
+
+// The first load installs the tree in the manager.
+TEST_F(TreeReloaderTest, LoadInstallsTree) {
+    BTManager manager;
+    TreeReloader uut_(manager, factory_);
+
+    const auto report = uut_.load(NodeDescription{"Sequence", "root", {}, {counter("a", 1), counter("b", 2)}});
+    EXPECT_EQ(report.created_nodes, 3u);
+    EXPECT_EQ(report.reused_nodes, 0u);
+
+    EXPECT_TRUE(manager.hasStagedTree());
+    EXPECT_EQ(manager.run(10), NodeResult::SUCCESS);
+    EXPECT_FALSE(manager.hasStagedTree());
+    EXPECT_EQ(manager.getLastTickCount(), 3u);
+}
+
+// Unchanged subtrees keep their node instances and their state.
+TEST_F(TreeReloaderTest, ReloadPreservesUnchangedSubtrees) {
+    BTManager manager;
+    TreeReloader uut_(manager, factory_);
+    const NodeDescription kept{"Sequence", "kept", {}, {counter("a", 100), counter("b", 100)}};
+
+    uut_.load(NodeDescription{"Fallback", "root", {}, {kept, counter("c", 100)}});
+    EXPECT_EQ(manager.run(5), NodeResult::FAILURE);
+    auto counter_a = counters_[0];
+    EXPECT_EQ(counter_a->count_, 5u);
+
+    // Change the other branch and the root.
+    const auto report =
+        uut_.reloadAsync(NodeDescription{"Sequence", "new_root", {}, {kept, counter("d", 1)}}).get();
+    EXPECT_EQ(report.reused_nodes, 3u);
+    EXPECT_EQ(report.created_nodes, 2u);
+
+    // The running child of `kept` resumes where it was.
+    manager.run(1);
+    EXPECT_EQ(counter_a->count_, 6u);
+    EXPECT_EQ(counters_.size(), 4u);
+}
+
+// Building the new tree doesn't stop the ticks of the current one.
+TEST_F(TreeReloaderTest, ReloadDoesNotBlockRun) {
+    BTManager manager;
+    TreeReloader uut_(manager, factory_);
+    uut_.load(counter("slow", UINT32_MAX));
+    manager.run(1);
+
+    build_delay_ = std::chrono::milliseconds(200);
+    auto reload = uut_.reloadAsync(counter("fast", 1));
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(manager.run(10), NodeResult::FAILURE);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+    reload.get();
+    EXPECT_EQ(manager.run(10), NodeResult::SUCCESS);
+    EXPECT_EQ(manager.getLastTickCount(), 1u);
+}
+
+// Invalid descriptions are reported and leave the current tree untouched.
+TEST_F(TreeReloaderTest, InvalidReloadKeepsTree) {
+    BTManager manager;
+    TreeReloader uut_(manager, factory_);
+    uut_.load(counter("a", 2));
+
+    EXPECT_THROW({ uut_.reloadAsync(NodeDescription{"Unknown", "x", {}, {}}).get(); }, std::invalid_argument);
+    EXPECT_THROW({ uut_.load(NodeDescription{"Sequence", "a", {}, {counter("a", 1)}}); }, std::runtime_error);
+    EXPECT_THROW({ uut_.load(NodeDescription{"Negation", "n", {}, {}}); }, std::invalid_argument);
+
+    EXPECT_EQ(manager.run(10), NodeResult::SUCCESS);
+    EXPECT_EQ(manager.getLastTickCount(), 2u);
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
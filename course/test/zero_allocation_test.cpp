@@ -0,0 +1,280 @@
+/**
+ * @file zero_allocation_test.cpp
+ * @brief Checks that ticking a warmed-up tree and writing pre-registered blackboard keys
+ *        never allocate. The global operator new and malloc are replaced in this binary so
+ *        every allocation made while an AllocationScope is alive is counted.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Challenge includes
+#include "BehaviorTree/Any.hpp"
+#include "BehaviorTree/BTManager.hpp"
+#include "BehaviorTree/Blackboard.hpp"
+#include "BehaviorTree/BlackboardTransaction.hpp"
+#include "BehaviorTree/NodeUtils.hpp"
+#include "BehaviorTree/Nodes/AdaptiveFallbackNode.hpp"
+#include "BehaviorTree/Nodes/CooldownNode.hpp"
+#include "BehaviorTree/Nodes/FallbackNode.hpp"
+#include "BehaviorTree/Nodes/LazySubtreeNode.hpp"
+#include "BehaviorTree/Nodes/NegationNode.hpp"
+#include "BehaviorTree/Nodes/RateLimitNode.hpp"
+#include "BehaviorTree/Nodes/SequenceNode.hpp"
+#include "BehaviorTree/Nodes/SubtreeInstanceNode.hpp"
+#include "BehaviorTree/Nodes/TimeoutNode.hpp"
+#include "BehaviorTree/Nodes/UtilitySelectorNode.hpp"
+#include "BehaviorTree/SharedSubtree.hpp"
+
+// Testing
+#include <gtest/gtest.h>
+
+// glibc entry points, used by the replacements below to reach the real allocator.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* pointer);
+}
+
+namespace {
+
+std::atomic<bool> tracking{false};
+std::atomic<uint64_t> allocations{0};
+
+void* countedAllocation(void* pointer) {
+    if (tracking.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    return pointer;
+}
+
+void* newOrThrow(size_t size, size_t alignment = 0) {
+    void* pointer = (alignment == 0) ? __libc_malloc(size == 0 ? 1 : size) : __libc_memalign(alignment, size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return countedAllocation(pointer);
+}
+
+}  // namespace
+
+extern "C" {
+void* malloc(size_t size) { return countedAllocation(__libc_malloc(size)); }
+void* calloc(size_t count, size_t size) { return countedAllocation(__libc_calloc(count, size)); }
+void* realloc(void* pointer, size_t size) { return countedAllocation(__libc_realloc(pointer, size)); }
+void free(void* pointer) { __libc_free(pointer); }
+}
+
+void* operator new(size_t size) { return newOrThrow(size); }
+void* operator new[](size_t size) { return newOrThrow(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return newOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return newOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAllocation(__libc_malloc(size)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAllocation(__libc_malloc(size)); }
+void operator delete(void* pointer) noexcept { __libc_free(pointer); }
+void operator delete[](void* pointer) noexcept { __libc_free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { __libc_free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { __libc_free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { __libc_free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { __libc_free(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { __libc_free(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { __libc_free(pointer); }
+
+using namespace ::testing;
+
+namespace behavior_tree {
+
+namespace test {
+
+/** @brief Counts the allocations made while it is alive. Scopes can't be nested. */
+class AllocationScope {
+   public:
+    AllocationScope() {
+        allocations.store(0);
+        tracking.store(true);
+    }
+    ~AllocationScope() { stop(); }
+
+    /** @brief Stops counting and returns the amount of allocations. */
+    uint64_t stop() {
+        tracking.store(false);
+        return allocations.load();
+    }
+};
+
+// Leaf that writes a pre-registered key of the blackboard and alternates its result.
+class WriterNode : public NodeInterface {
+   public:
+    WriterNode(const std::string& name, std::shared_ptr<Blackboard> blackboard)
+        : NodeInterface(name), blackboard_{blackboard} {}
+
+    NodeResult tick() override {
+        ++count_;
+        blackboard_->set(getNameRef(), static_cast<double>(count_));
+        const NodeResult results[] = {NodeResult::FAILURE, NodeResult::SUCCESS, NodeResult::RUNNING};
+        return results[count_ % 3];
+    }
+
+   private:
+    std::shared_ptr<Blackboard> blackboard_;
+    uint64_t count_ = 0;
+};
+
+// The harness itself catches both kinds of allocations.
+TEST(ZeroAllocationTest, HarnessCountsAllocations) {
+    void* (*volatile allocate)(size_t) = std::malloc;
+    AllocationScope scope;
+    void* pointer = allocate(32);
+    auto object = std::make_unique<std::vector<int>>(16);
+    EXPECT_EQ(scope.stop(), 3u);
+    std::free(pointer);
+}
+
+// Any assigns in place when it holds the same type, and copies on write when it is shared.
+TEST(ZeroAllocationTest, AnySetInPlace) {
+    Any any(1.0);
+    {
+        AllocationScope scope;
+        any.set(2.0);
+        EXPECT_EQ(scope.stop(), 0u);
+    }
+    Any copy = any;
+    {
+        AllocationScope scope;
+        any.set(3.0);
+        EXPECT_GT(scope.stop(), 0u);
+    }
+    EXPECT_EQ(*any.tryGet<double>(), 3.0);
+    EXPECT_EQ(*copy.tryGet<double>(), 2.0);
+}
+
+// Writes of values of the registered type don't allocate, the first write of a new key does.
+TEST(ZeroAllocationTest, BlackboardRegisteredKeys) {
+    Blackboard blackboard;
+    const std::string key = "a_key_too_long_for_the_small_string_buffer";
+    blackboard.registerKey<double>(key);
+    blackboard.registerKey<double>(key, 5.0);
+    EXPECT_EQ(*blackboard.tryGet<double>(key), 0.0);
+    {
+        AllocationScope scope;
+        for (int i = 0; i < 100; ++i) {
+            blackboard.set(key, static_cast<double>(i));
+        }
+        EXPECT_EQ(scope.stop(), 0u);
+    }
+    EXPECT_EQ(*blackboard.tryGet<double>(key), 99.0);
+    EXPECT_EQ(blackboard.getWriteCount(), 100u);
+    {
+        AllocationScope scope;
+        blackboard.set("another_key_too_long_for_the_small_string_buffer", 1.0);
+        EXPECT_GT(scope.stop(), 0u);
+    }
+    // Changing the type replaces the value.
+    blackboard.set(key, 1);
+    EXPECT_EQ(*blackboard.tryGet<int>(key), 1);
+}
+
+// A transaction reused with the same keys commits without allocating.
+TEST(ZeroAllocationTest, BlackboardTransaction) {
+    Blackboard blackboard;
+    BlackboardTransaction transaction(blackboard);
+    const std::string pose = "pose_key_too_long_for_the_small_string_buffer";
+    const std::string stamp = "stamp_key_too_long_for_the_small_string_buffer";
+    auto commit = [&](int tick) {
+        transaction.set(pose, static_cast<double>(tick));
+        transaction.set(stamp, tick);
+        transaction.commit();
+    };
+    // Warm-up: the keys are resolved and both sides hold a value of each type.
+    commit(0);
+    commit(1);
+    {
+        AllocationScope scope;
+        for (int tick = 2; tick < 100; ++tick) {
+            commit(tick);
+        }
+        EXPECT_EQ(scope.stop(), 0u);
+    }
+    EXPECT_EQ(*blackboard.tryGet<double>(pose), 99.0);
+    EXPECT_EQ(*blackboard.tryGet<int>(stamp), 99);
+}
+
+// Once warmed up, ticking a tree made of every built-in node doesn't allocate.
+TEST(ZeroAllocationTest, BTManagerTicksWithoutAllocating) {
+    BTManager manager(TickMode::EAGER);
+    auto blackboard = manager.getBlackboard();
+    auto writer = [&](const std::string& name) {
+        blackboard->registerKey<double>(name);
+        return manager.makeNode<WriterNode>(name, blackboard);
+    };
+
+    auto sequence = manager.makeNode<SequenceNode>(
+        "sequence", std::vector<std::shared_ptr<NodeInterface>>{writer("writer_a"), writer("writer_b")});
+    auto negation = manager.makeNode<NegationNode>("negation", writer("writer_c"));
+    auto rate_limit = manager.makeNode<RateLimitNode>("rate_limit", writer("writer_d"), uint32_t{2});
+    auto cooldown = manager.makeNode<CooldownNode>("cooldown", writer("writer_e"), std::chrono::microseconds(1));
+    auto timeout = manager.makeNode<TimeoutNode>("timeout", writer("writer_f"), std::chrono::seconds(1));
+    auto utility = manager.makeNode<UtilitySelectorNode>(
+        "utility", blackboard, std::vector<std::string>{"writer_a"},
+        std::vector<std::shared_ptr<NodeInterface>>{writer("writer_g"), writer("writer_h")},
+        std::vector<UtilityScoring>{{0.0f, {1.0f}}, {10.0f, {-1.0f}}});
+
+    SharedSubtree::Builder builder;
+    const auto first = builder.addLeaf(std::make_shared<WriterNode>("shared_a", blackboard));
+    const auto second = builder.addLeaf(std::make_shared<WriterNode>("shared_b", blackboard));
+    blackboard->registerKey<double>("shared_a");
+    blackboard->registerKey<double>("shared_b");
+    auto instance =
+        manager.makeNode<SubtreeInstanceNode>("instance", builder.build(builder.addSequence({first, second})));
+    auto lazy = manager.makeNode<LazySubtreeNode>(
+        "lazy", [blackboard]() { return std::make_shared<WriterNode>("writer_i", blackboard); });
+    blackboard->registerKey<double>("writer_i");
+
+    auto adaptive = manager.makeNode<AdaptiveFallbackNode>(
+        "adaptive", std::vector<std::shared_ptr<NodeInterface>>{negation, rate_limit, cooldown, timeout, utility});
+    // Sequences never fail, the negation lets the fallback go past the subtree instance.
+    auto not_instance = manager.makeNode<NegationNode>("not_instance", instance);
+    manager.makeNode<FallbackNode>(
+        "root", std::vector<std::shared_ptr<NodeInterface>>{lazy, not_instance, adaptive, sequence});
+    const auto statistics = manager.enableStatistics();
+
+    // Warm-up: the lazy subtree is built and every node reaches its steady state.
+    for (int run = 0; run < 100; ++run) {
+        manager.run(10);
+    }
+    const uint64_t writes = blackboard->getWriteCount();
+
+    AllocationScope scope;
+    for (int run = 0; run < 1000; ++run) {
+        manager.run(10);
+    }
+    EXPECT_EQ(scope.stop(), 0u);
+    EXPECT_GT(blackboard->getWriteCount(), writes);
+    EXPECT_TRUE(lazy->isMaterialized());
+}
+
+}  // namespace test
+
+}  // namespace behavior_tree
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}